@@ -0,0 +1,223 @@
+#include "glex/common/log.h"
+#include "glex/graphics/MeshLoader.h"
+#include "glex/math/FastTrig.h"
+#include "glex/math/Matrix.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#ifndef DREAMCAST
+#include <thread>
+#endif
+
+// Silence annoying printf float warning on Dreamcast 
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wformat"
+#endif
+
+// Micro benchmarks for engine hot paths, run without a window. Each compares the GLEX
+// implementation with the straightforward one it replaces and reports the accuracy difference.
+
+static constexpr int ANGLE_COUNT = 4096;
+static constexpr int ITERATIONS = 64;
+static constexpr float DEGREES_TO_RADIANS = 3.14159265358979323846f / 180.0f;
+
+// Written to so the compiler can't drop the benchmarked work
+static volatile float sink;
+
+static double elapsedMilliseconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static std::vector<float> makeAngles() {
+    // Spread over several turns in both directions, like accumulated rotation angles
+    std::vector<float> angles(ANGLE_COUNT);
+    for (int i = 0; i < ANGLE_COUNT; i++) {
+        angles[i] = (i - ANGLE_COUNT / 2) * 0.731f;
+    }
+    return angles;
+}
+
+static void benchmarkSinCos(const std::vector<float>& angles) {
+    std::vector<float> sines(ANGLE_COUNT);
+    std::vector<float> cosines(ANGLE_COUNT);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+        for (int i = 0; i < ANGLE_COUNT; i++) {
+            sines[i] = sinf(angles[i] * DEGREES_TO_RADIANS);
+            cosines[i] = cosf(angles[i] * DEGREES_TO_RADIANS);
+        }
+        sink = sines[iteration] + cosines[iteration];
+    }
+    double libmTime = elapsedMilliseconds(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+        for (int i = 0; i < ANGLE_COUNT; i++) {
+            glex::fastSinCos(angles[i], sines[i], cosines[i]);
+        }
+        sink = sines[iteration] + cosines[iteration];
+    }
+    double fastTime = elapsedMilliseconds(start);
+
+    float maxError = 0;
+    for (float angle : angles) {
+        float sine, cosine;
+        glex::fastSinCos(angle, sine, cosine);
+        maxError = std::max(maxError, fabsf(sine - sinf(angle * DEGREES_TO_RADIANS)));
+        maxError = std::max(maxError, fabsf(cosine - cosf(angle * DEGREES_TO_RADIANS)));
+    }
+
+    const int calls = ANGLE_COUNT * ITERATIONS;
+    DEBUG_PRINTLN("sin + cos (%d calls)", calls);
+    DEBUG_PRINTLN("    libm:             %8.3f ms  (%.1f ns per call)", libmTime, libmTime * 1000000.0 / calls);
+    DEBUG_PRINTLN("    glex::fastSinCos: %8.3f ms  (%.1f ns per call)", fastTime, fastTime * 1000000.0 / calls);
+    DEBUG_PRINTLN("    max error: %g", maxError);
+}
+
+static void benchmarkRotation(const std::vector<float>& angles) {
+    // The same rotations the drawables used to make with three glRotatef calls
+    auto start = std::chrono::steady_clock::now();
+    float sum = 0;
+    for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+        for (int i = 0; i < ANGLE_COUNT - 2; i++) {
+            Matrix4 matrix;
+            matrix.rotate(angles[i + 2], 0.0f, 0.0f, 1.0f);
+            matrix.rotate(angles[i + 1], 0.0f, 1.0f, 0.0f);
+            matrix.rotate(angles[i], 1.0f, 0.0f, 0.0f);
+            sum += matrix.m[0];
+        }
+    }
+    sink = sum;
+    double chainedTime = elapsedMilliseconds(start);
+
+    start = std::chrono::steady_clock::now();
+    sum = 0;
+    for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+        for (int i = 0; i < ANGLE_COUNT - 2; i++) {
+            Matrix4 matrix = Matrix4::rotationZYX(angles[i], angles[i + 1], angles[i + 2]);
+            sum += matrix.m[0];
+        }
+    }
+    sink = sum;
+    double oneStepTime = elapsedMilliseconds(start);
+
+    float maxError = 0;
+    for (int i = 0; i < ANGLE_COUNT - 2; i++) {
+        Matrix4 chained;
+        chained.rotate(angles[i + 2], 0.0f, 0.0f, 1.0f);
+        chained.rotate(angles[i + 1], 0.0f, 1.0f, 0.0f);
+        chained.rotate(angles[i], 1.0f, 0.0f, 0.0f);
+        Matrix4 oneStep = Matrix4::rotationZYX(angles[i], angles[i + 1], angles[i + 2]);
+        for (int j = 0; j < 16; j++) {
+            maxError = std::max(maxError, fabsf(chained.m[j] - oneStep.m[j]));
+        }
+    }
+
+    const int matrices = (ANGLE_COUNT - 2) * ITERATIONS;
+    DEBUG_PRINTLN("Z, Y, X rotation matrix (%d matrices)", matrices);
+    DEBUG_PRINTLN("    3x Matrix4::rotate:   %8.3f ms  (%.1f ns per matrix)", chainedTime, chainedTime * 1000000.0 / matrices);
+    DEBUG_PRINTLN("    Matrix4::rotationZYX: %8.3f ms  (%.1f ns per matrix)", oneStepTime, oneStepTime * 1000000.0 / matrices);
+    DEBUG_PRINTLN("    max error: %g", maxError);
+}
+
+#ifndef DREAMCAST
+// Writes a size x size vertex grid with texture coordinates and normals, a stand in for a
+// scanned model. Returns the file size in bytes.
+static long writeGridObj(const char* path, int size) {
+    FILE* file = fopen(path, "w");
+    if (file == NULL) {
+        return 0;
+    }
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            fprintf(file, "v %f %f %f\n", x * 0.01f, y * 0.01f, sinf(x * 0.1f) * cosf(y * 0.1f));
+        }
+    }
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            fprintf(file, "vt %f %f\n", x / (float)(size - 1), y / (float)(size - 1));
+        }
+    }
+    fprintf(file, "vn 0 0 1\n");
+    for (int y = 0; y < size - 1; y++) {
+        for (int x = 0; x < size - 1; x++) {
+            int a = y * size + x + 1;
+            int b = a + 1;
+            int c = a + size + 1;
+            int d = a + size;
+            fprintf(file, "f %d/%d/1 %d/%d/1 %d/%d/1 %d/%d/1\n", a, a, b, b, c, c, d, d);
+        }
+    }
+    long fileSize = ftell(file);
+    fclose(file);
+    return fileSize;
+}
+
+static void benchmarkObjLoading(std::string path) {
+    // Without a path, generate a large mesh so there's enough work to split between threads
+    bool isGenerated = path.empty();
+    long fileSize = 0;
+    if (isGenerated) {
+        path = "glex_benchmark_grid.obj";
+        fileSize = writeGridObj(path.c_str(), 700);
+    } else {
+        FILE* file = fopen(path.c_str(), "rb");
+        if (file != NULL) {
+            fseek(file, 0, SEEK_END);
+            fileSize = ftell(file);
+            fclose(file);
+        }
+    }
+    if (fileSize <= 0) {
+        ERROR_PRINTLN("Couldn't read %s", path.c_str());
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    MeshData* meshData = MeshLoader::loadObjMesh(path);
+    double serialTime = elapsedMilliseconds(start);
+    delete meshData;
+
+    start = std::chrono::steady_clock::now();
+    meshData = MeshLoader::loadObjMeshParallel(path, 1);
+    double oneThreadTime = elapsedMilliseconds(start);
+    delete meshData;
+
+    start = std::chrono::steady_clock::now();
+    meshData = MeshLoader::loadObjMeshParallel(path);
+    double parallelTime = elapsedMilliseconds(start);
+    delete meshData;
+
+    if (isGenerated) {
+        remove(path.c_str());
+    }
+
+    const double megabytes = fileSize / (1024.0 * 1024.0);
+    DEBUG_PRINTLN("OBJ loading (%.1f MB, %u hardware threads)", megabytes, std::thread::hardware_concurrency());
+    DEBUG_PRINTLN("    loadObjMesh:                %8.1f ms  (%.1f MB/s)", serialTime, megabytes * 1000.0 / serialTime);
+    DEBUG_PRINTLN("    loadObjMeshParallel(1):     %8.1f ms  (%.1f MB/s)", oneThreadTime, megabytes * 1000.0 / oneThreadTime);
+    DEBUG_PRINTLN("    loadObjMeshParallel(all):   %8.1f ms  (%.1f MB/s)", parallelTime, megabytes * 1000.0 / parallelTime);
+}
+#endif
+
+// Usage: GLEXBenchmark [mesh.obj]
+int main(int argc, char *argv[]) {
+    DEBUG_PRINTLN("GLEX Benchmark");
+    std::vector<float> angles = makeAngles();
+    benchmarkSinCos(angles);
+    benchmarkRotation(angles);
+#ifndef DREAMCAST
+    // Parallel loading is for PC hosts, the Dreamcast has one core (and no large OBJs)
+    benchmarkObjLoading(argc > 1 ? argv[1] : "");
+#else
+    (void)argc;
+    (void)argv;
+#endif
+    return 0;
+}
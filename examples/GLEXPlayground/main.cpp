@@ -13,6 +13,8 @@
 #include "glex/graphics/Image.h"
 #include "glex/graphics/Text.h"
 #include "glex/graphics/MeshLoader.h"
+#include "glex/graphics/TextureManager.h"
+#include "glex/graphics/RenderQueue.h"
 #include "glex/input/KeyboardInputHandler.h"
 #include "glex/input/MouseInputHandler.h"
 #include "glex/input/GamepadInputHandler.h"
@@ -274,20 +276,17 @@ int main(int argc, char *argv[]) {
     //       impact on loading time than the format. So I found JPG files load significantly
     //       faster than either PNG or BMP with no noticeable loss in quality (though no alpha).
 
-    Texture grayBrickTexture;
-    grayBrickTexture.loadRGB("images/gray_brick_512.jpg");
-    Image grayBrickImage(&grayBrickTexture, 0, (float)app.windowHeight(), Image::Z_BACKGROUND, (float)app.windowWidth(), (float)app.windowHeight(), app.screenScale);
+    std::shared_ptr<Texture> grayBrickTexture = TextureManager::loadRGB("images/gray_brick_512.jpg");
+    Image grayBrickImage(grayBrickTexture.get(), 0, (float)app.windowHeight(), Image::Z_BACKGROUND, (float)app.windowWidth(), (float)app.windowHeight(), app.screenScale);
 
-    Texture woodTexture;
-    woodTexture.loadRGB("images/wood1.bmp");
-    Image woodImage(&woodTexture, 250, 420, 10, Image::Z_HUD, 100, app.screenScale);
+    std::shared_ptr<Texture> woodTexture = TextureManager::loadRGB("images/wood1.bmp");
+    Image woodImage(woodTexture.get(), 250, 420, 10, Image::Z_HUD, 100, app.screenScale);
 
     Triangle triangle(250, 220, 10, Image::Z_HUD, 100, app.screenScale);
 
     MeshData *houseMesh = MeshLoader::loadObjMesh("meshes/house.obj");
-    Texture houseTexture;
-    houseTexture.loadRGBA("images/house_512.png");
-    Mesh mesh(houseMesh, &houseTexture, 0.3f);
+    std::shared_ptr<Texture> houseTexture = TextureManager::loadRGBA("images/house_512.png");
+    Mesh mesh(houseMesh, houseTexture.get(), 0.3f);
 
     Cube cube;
 
@@ -296,6 +295,9 @@ int main(int argc, char *argv[]) {
     Text fpsCounter(fontFace, "", darkBlue, 20, 20, Image::Z_HUD, app.screenScale);
     fpsCounter.createTexture();
 
+    // Everything is submitted to the render queue and drawn at once, sorted to minimize state changes
+    RenderQueue renderQueue;
+
 #ifdef DREAMCAST
     // Init perf counter
     PMCR_Init(PERF_COUNTER_WHICH, PMCR_ELAPSED_TIME_MODE, PMCR_COUNT_CPU_CYCLES);
@@ -334,28 +336,31 @@ int main(int argc, char *argv[]) {
         app.clear();
 
         // Draw the background image
-        app.reshapeOrtho(1.0);        
-        grayBrickImage.draw();
+        renderQueue.setOrtho(1.0);
+        grayBrickImage.submit(renderQueue);
 
         // Draw the 3d rotating house
-        app.reshapeFrustum();
-        mesh.draw();
+        renderQueue.setFrustum();
+        mesh.submit(renderQueue);
         mesh.rotationX += 0.75;
         mesh.rotationY += 0.75;
         mesh.rotationZ += 0.75;
-        // cube.draw();
+        // cube.submit(renderQueue);
 
         // Draw the foreground 2d image
-        app.reshapeOrtho(1.0);
-        woodImage.draw();
-        triangle.draw();
+        renderQueue.setOrtho(1.0);
+        woodImage.submit(renderQueue);
+        triangle.submit(renderQueue);
 
         // Draw the FPS counter HUD text
-        app.reshapeOrtho(fpsCounter.scale);
-        static char outputString[50];
-        snprintf(&outputString[0], 50, "frame time: %.2f ms  fps: %d  key: %d", frameTime, fps, lastKeyCode);
+        renderQueue.setOrtho(fpsCounter.scale);
+        static char outputString[100];
+        snprintf(&outputString[0], 100, "frame time: %.2f ms  fps: %d  key: %d  gl calls: %u (%u skipped)", frameTime, fps, lastKeyCode, 
+                 GLStateCache::lastFrameIssuedCalls(), GLStateCache::lastFrameSkippedCalls());
         fpsCounter.text = outputString;
-        fpsCounter.draw();
+        fpsCounter.submit(renderQueue);
+
+        renderQueue.flush(app);
 
         // Swap buffers to display the current frame
         app.swapBuffers();
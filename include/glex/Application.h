@@ -1,5 +1,6 @@
 #pragma once
 #include "glex/common/gl.h"
+#include "glex/common/frustum.h"
 #include "glex/input/InputHandler.h"
 
 #include <string>
@@ -11,16 +12,22 @@
 void _sizeCallback(GLFWwindow* window, int width, int height);
 #endif
 
+class AssetLoader;
+
 class Application {
 public:
     float screenScale = 1.0; // GLFW only, to handle scaled displays (i.e. macOS Retina)
     bool vsyncEnabled = true; // By default, lock to 60fps (or whatever refresh rate the monitor is)
+    bool modernRendererEnabled = true; // GLFW only, use the GL 3.3 render backend if available (set before createWindow)
+    double assetUploadBudget = 2.0; // Milliseconds per frame spent uploading assets loaded by assetLoader()
     std::string windowName() { return _windowName; }
     int windowWidth() { return _windowWidth; }
     int windowHeight() { return _windowHeight; }
     const std::vector<std::shared_ptr<InputHandler>> inputHandlers() { return _inputHandlers; }
+    const Frustum& frustum() { return _frustum; } // The camera set by reshapeFrustum()
     
-    Application() {};
+    Application();
+    ~Application();
     void createWindow(std::string windowName, int width, int height);
     void closeWindow();
     void reshapeFrustum();
@@ -32,6 +39,9 @@ public:
     void handleInput();
     void addInputHandler(std::shared_ptr<InputHandler> inputHandler);
     void removeInputHandler(std::shared_ptr<InputHandler> inputHandler);
+    // Loads assets in the background, their GL uploads run after each swapBuffers(). The worker
+    // threads are started the first time this is called.
+    AssetLoader& assetLoader();
 
 private:
 #ifdef GLFW
@@ -40,13 +50,19 @@ private:
     std::string _windowName = "";
     int _windowWidth = 0;
     int _windowHeight = 0;
+    Frustum _frustum;
     std::vector<std::shared_ptr<InputHandler>> _inputHandlers;
+    std::unique_ptr<AssetLoader> _assetLoader;
 
     Application(Application const&);    // Prevent copies
     void operator=(Application const&); // Prevent assignments
     void _updateWindowSize();
+#ifdef GLFW
+    void _setWindowHints();
+#endif
     void _reshapeFrustum(int width, int height);
     void _reshapeOrtho(int width, int height);
+    void _processAssetUploads();
 
 #ifdef GLFW
     friend void _sizeCallback(GLFWwindow* window, int width, int height);
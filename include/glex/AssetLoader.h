@@ -0,0 +1,123 @@
+#pragma once
+#include "glex/common/mesh.h"
+#include "glex/graphics/Texture.h"
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef DREAMCAST
+#include <kos/thread.h>
+#include <kos/mutex.h>
+#include <kos/cond.h>
+#include "glex/audio/Audio.h"
+#else
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+enum class AssetState {
+    Loading,
+    Ready,
+    Failed
+};
+
+class AssetHandleBase {
+public:
+    virtual ~AssetHandleBase() {};
+
+    AssetState state() const { return _state.load(std::memory_order_acquire); }
+    bool isReady() const { return state() == AssetState::Ready; }
+    bool isFinished() const { return state() != AssetState::Loading; }
+    const std::string& path() const { return _path; }
+
+protected:
+    friend class AssetLoader;
+    std::string _path;
+    std::atomic<AssetState> _state { AssetState::Loading };
+};
+
+// An asset that is loading in the background. Poll it each frame, asset() is set once it's ready.
+template <typename T>
+class AssetHandle : public AssetHandleBase {
+public:
+    std::shared_ptr<T> asset() const { return isReady() ? _asset : nullptr; }
+
+private:
+    friend class AssetLoader;
+    std::shared_ptr<T> _asset;
+};
+
+/*
+ * Loads assets without blocking the render loop. Files are read and decoded on worker threads
+ * (std::thread on PC, KOS threads on the Dreamcast, where the worker runs at a lower priority than
+ * the main thread). Anything that needs GL is then queued for the main thread, where
+ * processUploads() runs as much of it as fits in a time budget.
+ *
+ * Application owns one (see Application::assetLoader()) and processes its uploads after every
+ * swapBuffers(), within Application::assetUploadBudget.
+ */
+class AssetLoader {
+public:
+    // workerCount 0 picks a default: one less than the number of cores on PC, one on the Dreamcast
+    AssetLoader(unsigned workerCount = 0);
+    // Waits for the assets being decoded, the rest are dropped and marked as failed
+    ~AssetLoader();
+
+    // JPG, PNG or BMP, decoded (and mipmapped and converted to a 16 bit format) on a worker and
+    // uploaded on the main thread. .glextex files are read as they are and ignore the other options.
+    std::shared_ptr<AssetHandle<Texture>> loadTexture(std::string path, bool hasAlpha = true,
+                                                      TextureFormat format = TextureFormat::Default, bool dither = true,
+                                                      MipmapFilter mipmapFilter = MipmapFilter::None);
+    // A .glexmesh file or an OBJ (parsed on the worker), ready without any GL work since meshes
+    // upload their geometry the first time they're drawn
+    std::shared_ptr<AssetHandle<MeshData>> loadMesh(std::string path);
+#ifdef DREAMCAST
+    // Loaded into sound RAM from the worker
+    std::shared_ptr<AssetHandle<Audio>> loadAudio(std::string path);
+#endif
+
+    // Call on the GL thread. Runs queued uploads until budgetMilliseconds have passed (always at
+    // least one, so large uploads can't stall loading) and returns how many ran.
+    size_t processUploads(double budgetMilliseconds);
+    // Assets not finished yet, i.e. for a loading screen's progress
+    size_t pendingCount();
+
+private:
+    struct Job {
+        std::shared_ptr<AssetHandleBase> handle;
+        std::function<void()> run;
+    };
+
+    std::deque<Job> _decodeJobs;
+    std::deque<Job> _uploadJobs;
+    size_t _pendingCount = 0;
+    bool _isStopping = false;
+
+#ifdef DREAMCAST
+    std::vector<kthread_t*> _threads;
+    mutex_t _mutex;
+    condvar_t _condition;
+#else
+    std::vector<std::thread> _threads;
+    std::mutex _mutex;
+    std::condition_variable _condition;
+#endif
+
+    AssetLoader(AssetLoader const&);    // Prevent copies
+    void operator=(AssetLoader const&); // Prevent assignments
+    void _lock();
+    void _unlock();
+    void _workerLoop();
+    void _queueDecode(std::shared_ptr<AssetHandleBase> handle, std::function<void()> decode);
+    void _queueUpload(std::shared_ptr<AssetHandleBase> handle, std::function<void()> upload);
+    void _finish(AssetHandleBase& handle, bool success);
+
+#ifdef DREAMCAST
+    friend void* _assetLoaderThread(void* loader);
+#endif
+};
@@ -0,0 +1,14 @@
+#pragma once
+
+// Axis aligned box around all of an object's vertices
+struct BoundingBox {
+    float min[3] = { 0, 0, 0 };
+    float max[3] = { 0, 0, 0 };
+};
+
+// Sphere around all of an object's vertices, cheaper to test than a box and doesn't change
+// when the object rotates
+struct BoundingSphere {
+    float center[3] = { 0, 0, 0 };
+    float radius = 0;
+};
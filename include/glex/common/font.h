@@ -33,7 +33,8 @@
  */
 
 #pragma once
-#include <cstring>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 typedef struct
@@ -49,21 +50,42 @@ typedef struct
     int offset_x, offset_y;
     float advance_x, advance_y;
     float s0, t0, s1, t1;
+    size_t kerning_index;   // First entry in the font's kerning table
     size_t kerning_count;
-    std::vector<kerning_t> kerning;
 } texture_glyph_t;
 
+typedef struct
+{
+    wchar_t charcode;
+    size_t index;
+} glyph_lookup_entry_t;
+
 typedef struct
 {
     size_t tex_width;
     size_t tex_height;
     size_t tex_depth;
-    std::vector<unsigned char> tex_data;
+    const unsigned char* tex_data;
     float size;
     float height;
     float linegap;
     float ascender;
     float descender;
     size_t glyphs_count;
-    std::vector<texture_glyph_t> glyphs;
+    const texture_glyph_t* glyphs;
+    const kerning_t* kerning;
+
+    // Glyph lookup tables, built by texture_font_create()
+    int16_t glyph_lookup_latin1[256];                  // Index into glyphs, or -1 if there is no glyph
+    std::vector<glyph_lookup_entry_t> glyph_lookup;    // All other glyphs, sorted by charcode
 } texture_font_t;
+
+// Wraps font data that lives in read-only memory (see src/fonts) and builds its glyph lookup
+// tables. The atlas, glyph and kerning tables are referenced, not copied.
+texture_font_t texture_font_create(size_t tex_width, size_t tex_height, size_t tex_depth, const unsigned char* tex_data,
+                                   float size, float height, float linegap, float ascender, float descender,
+                                   size_t glyphs_count, const texture_glyph_t* glyphs, const kerning_t* kerning);
+
+// Finds the glyph for a character in O(1) for Latin-1 and O(log n) otherwise, or returns NULL
+// if the font doesn't have it
+const texture_glyph_t* texture_font_find_glyph(const texture_font_t* font, wchar_t charcode);
@@ -0,0 +1,42 @@
+#pragma once
+#include "bounds.h"
+
+// Plane ax + by + cz + d = 0 with the normal (a, b, c) pointing into the frustum
+struct Plane {
+    float a = 0;
+    float b = 0;
+    float c = 0;
+    float d = 0;
+
+    // Positive inside, negative outside
+    float distance(const float point[3]) const { return a * point[0] + b * point[1] + c * point[2] + d; }
+};
+
+/*
+ * The six planes of a view frustum, used to skip drawing objects that can't be on screen.
+ *
+ * Application::reshapeFrustum() sets the current frustum from the camera's projection and
+ * modelview matrices, so the planes are in the same space as the coordinates drawables are
+ * drawn in (before their own scaling and rotation). reshapeOrtho() clears it, since nothing
+ * drawn under the orthographic projection is in that space.
+ */
+class Frustum {
+public:
+    enum { PLANE_LEFT, PLANE_RIGHT, PLANE_BOTTOM, PLANE_TOP, PLANE_NEAR, PLANE_FAR, PLANE_COUNT };
+    Plane planes[PLANE_COUNT];
+
+    // Extracts the planes from projection * modelview (column major)
+    static Frustum fromMatrix(const float matrix[16]);
+
+    // Conservative tests: true if any part of the volume may be inside
+    bool intersects(const BoundingSphere& sphere) const;
+    bool intersects(const BoundingBox& box) const;
+
+    // The camera frustum set by Application::reshapeFrustum(), or nullptr when there is none or
+    // an orthographic projection has been set since
+    static const Frustum* current();
+    static void setCurrent(const Frustum& frustum);
+    static void clearCurrent();
+    // Makes the last frustum passed to setCurrent() current again, if there was one
+    static void restoreCurrent();
+};
@@ -10,3 +10,45 @@
     #define GLFW_INCLUDE_NONE
     #include <GLFW/glfw3.h>
 #endif
+
+#include <cstdint>
+
+/*
+ * Shadow copy of the GL state GLEX changes while drawing, so that calls that wouldn't change
+ * anything are dropped before they reach the driver. On the Dreamcast every state change makes
+ * GLdc rebuild the PVR polygon header, so this directly saves CPU time per draw.
+ *
+ * Everything in GLEX goes through this for the tracked state. If you change any of it with GL
+ * calls directly, call invalidate() afterwards so the next call is always issued.
+ */
+class GLStateCache {
+public:
+    // Capabilities tracked: GL_DEPTH_TEST, GL_BLEND, GL_TEXTURE_2D, GL_CULL_FACE, GL_LIGHTING
+    // (anything else is passed straight through)
+    static void enable(GLenum capability);
+    static void disable(GLenum capability);
+    static bool isEnabled(GLenum capability);
+
+    static void depthFunc(GLenum func);
+    static void blendFunc(GLenum sourceFactor, GLenum destinationFactor);
+    static void cullFace(GLenum mode);
+    static void texEnvMode(GLenum mode);
+
+    static void bindTexture(GLuint texture);
+    static void deleteTextures(GLsizei count, const GLuint* textures);
+
+    // Client arrays tracked: GL_VERTEX_ARRAY, GL_NORMAL_ARRAY, GL_TEXTURE_COORD_ARRAY, GL_COLOR_ARRAY
+    static void enableClientState(GLenum array);
+    static void disableClientState(GLenum array);
+
+    // Forget everything so the next call of each kind is always issued
+    static void invalidate();
+
+    // Counters for the current frame, and for the last complete frame. 
+    // Application::swapBuffers() calls endFrame() so there's no need to call it yourself.
+    static uint32_t issuedCalls();
+    static uint32_t skippedCalls();
+    static uint32_t lastFrameIssuedCalls();
+    static uint32_t lastFrameSkippedCalls();
+    static void endFrame();
+};
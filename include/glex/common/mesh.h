@@ -1,10 +1,60 @@
 #pragma once
+#include "bounds.h"
+
+#include <string>
 #include <vector>
 #include <cstddef>
+#include <cstdint>
+
+// One interleaved vertex, so drawing a vertex reads a single 32 byte block (one SH4 cache line)
+// instead of three separate arrays
+struct MeshVertex {
+    float x, y, z;
+    float nx, ny, nz;
+    float s, t;
+};
+static_assert(sizeof(MeshVertex) == 32, "MeshVertex must stay 32 bytes to fit a cache line");
+
+// A material from the mesh's MTL file
+struct MeshMaterial {
+    std::string name;
+    float diffuse[3] = { 1, 1, 1 };
+    float opacity = 1;
+    std::string diffuseTexturePath; // Relative to the working directory like other asset paths, empty if none
+    std::string diffuseTextureName; // As written in the material, relative to the mesh file's directory
+};
+
+// The faces that use one material. Its vertices and indices are contiguous ranges of the mesh's
+// arrays, and the indices count from its first vertex, so each one can be drawn on its own.
+struct SubMesh {
+    int materialIndex = -1; // -1 for faces without a material
+    size_t vertexOffset = 0;
+    size_t numVertices = 0;
+    size_t indexOffset = 0;
+    size_t numIndices = 0;
+};
 
 struct MeshData {
+    // Unique vertices, shared between triangles through the index buffer
     size_t numVertices = 0;
-    std::vector<float> vertices;
-    std::vector<float> textureCoordinates;
-    std::vector<float> normals;
-};
\ No newline at end of file
+    std::vector<MeshVertex> vertices;
+    bool hasNormals = false;            // If false the normals are all zero
+    bool hasTextureCoordinates = false; // If false the texture coordinates are all zero
+
+    // Triangle indices into each sub mesh's vertices. Only one of these is filled: 16 bit indices
+    // whenever every sub mesh has few enough vertices, 32 bit otherwise.
+    size_t numIndices = 0;
+    std::vector<uint16_t> indices16;
+    std::vector<uint32_t> indices32;
+
+    bool isIndices16() const { return !indices16.empty(); }
+
+    // Every shape in the file, one sub mesh per material, sorted by texture so that drawing them in
+    // order binds each texture once
+    std::vector<MeshMaterial> materials;
+    std::vector<SubMesh> subMeshes;
+
+    // Extent of the vertices in model space, for culling
+    BoundingBox boundingBox;
+    BoundingSphere boundingSphere;
+};
@@ -0,0 +1,69 @@
+#pragma once
+#include "mesh.h"
+
+#include <cstdint>
+
+/*
+ * The .glexmesh binary mesh format, written by saveBinaryMesh() (see the GLEXMeshConverter tool)
+ * and read by MeshLoader::loadBinaryMesh() without parsing anything per vertex.
+ *
+ * Layout, little endian like both the PC and the SH4:
+ *     MeshFileHeader
+ *     MeshFileMaterial[numMaterials]
+ *     MeshFileSubMesh[numSubMeshes]
+ *     MeshVertex[numVertices]
+ *     uint16_t or uint32_t[numIndices]
+ *
+ * Every section starts on a MESH_FILE_ALIGNMENT boundary (zero padded), so the file can be read
+ * in one go or memory mapped and the vertices used in place, a cache line per vertex.
+ */
+static constexpr char MESH_FILE_MAGIC[4] = { 'G', 'L', 'X', 'M' };
+static constexpr uint32_t MESH_FILE_VERSION = 1;
+static constexpr uint32_t MESH_FILE_ALIGNMENT = 32;
+
+// MeshFileHeader::flags
+static constexpr uint32_t MESH_FILE_HAS_NORMALS = 1 << 0;
+static constexpr uint32_t MESH_FILE_HAS_TEXTURE_COORDINATES = 1 << 1;
+static constexpr uint32_t MESH_FILE_INDICES_16 = 1 << 2;
+
+struct MeshFileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t flags;
+    uint32_t numMaterials;
+    uint32_t numSubMeshes;
+    uint32_t numVertices;
+    uint32_t numIndices;
+
+    // Byte offsets of each section from the start of the file
+    uint32_t materialsOffset;
+    uint32_t subMeshesOffset;
+    uint32_t verticesOffset;
+    uint32_t indicesOffset;
+    uint32_t fileSize;
+
+    float boundingBoxMin[3];
+    float boundingBoxMax[3];
+    float boundingSphereCenter[3];
+    float boundingSphereRadius;
+
+    uint32_t reserved[2];
+};
+static_assert(sizeof(MeshFileHeader) == 96, "MeshFileHeader is part of the file format");
+
+struct MeshFileMaterial {
+    char name[64];            // Zero terminated
+    char diffuseTexture[128]; // Zero terminated, relative to the .glexmesh file's directory
+    float diffuse[3];
+    float opacity;
+};
+static_assert(sizeof(MeshFileMaterial) == 208, "MeshFileMaterial is part of the file format");
+
+struct MeshFileSubMesh {
+    int32_t materialIndex;
+    uint32_t vertexOffset;
+    uint32_t numVertices;
+    uint32_t indexOffset;
+    uint32_t numIndices;
+};
+static_assert(sizeof(MeshFileSubMesh) == 20, "MeshFileSubMesh is part of the file format");
@@ -0,0 +1,38 @@
+#pragma once
+#include "glex/graphics/TextureFormat.h"
+
+#include <cstdint>
+
+/*
+ * The .glextex texture format, written by the GLEXTextureConverter tool and read by
+ * Texture::loadCompressed(). The pixels are stored exactly as the PVR samples them, so the
+ * Dreamcast uploads them without any conversion (PC converts them back to linear pixels).
+ *
+ * Layout, little endian like both the PC and the SH4:
+ *     TextureFileHeader
+ *     Pixel data, starting at dataOffset (a TEXTURE_FILE_ALIGNMENT boundary)
+ *
+ * The pixels are always in one of the 16 bit formats, bottom row first like glTexImage2D(), and
+ * twiddled if TEXTURE_FILE_TWIDDLED is set (see glex::twiddledIndex()). VQ compressed data is a
+ * codebook of 256 2x2 blocks of twiddled texels (2048 bytes), followed by one codebook index per
+ * 2x2 block of the texture, also twiddled: a texel costs 2 bits instead of 16.
+ */
+static constexpr char TEXTURE_FILE_MAGIC[4] = { 'G', 'L', 'X', 'T' };
+static constexpr uint32_t TEXTURE_FILE_VERSION = 1;
+static constexpr uint32_t TEXTURE_FILE_ALIGNMENT = 32;
+
+// TextureFileHeader::flags
+static constexpr uint32_t TEXTURE_FILE_TWIDDLED = 1 << 0;
+static constexpr uint32_t TEXTURE_FILE_VQ = 1 << 1; // Always twiddled as well
+
+struct TextureFileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t flags;
+    uint32_t format; // A 16 bit TextureFormat
+    uint32_t width;
+    uint32_t height;
+    uint32_t dataOffset;
+    uint32_t dataSize;
+};
+static_assert(sizeof(TextureFileHeader) == 32, "TextureFileHeader is part of the file format");
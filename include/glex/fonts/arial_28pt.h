@@ -1,4 +1,4 @@
 #pragma once
 #include "glex/common/font.h"
 
-extern texture_font_t arial_28pt;
+const texture_font_t* arial_28pt();
@@ -1,20 +1,31 @@
 #pragma once
 #include "glex/common/gl.h"
+#include "RenderState.h"
+#include "Geometry.h"
 #include "Texture.h"
 
+class RenderQueue;
+class SceneNode;
+
 class Cube {
 public:
     Texture* texture = nullptr;
+    SceneNode* node = nullptr; // Optional, when set its world matrix replaces the spinning
 
     Cube() {};
     Cube(Texture* texture_) { texture = texture_; }
 
     void draw();
+    void submit(RenderQueue& queue);
 
 private:
     GLfloat _anglex = 0.0;
     GLfloat _angley = 0.0;
     GLfloat _anglez = 0.0;    
+    Geometry _colorGeometry;
+    Geometry _textureGeometry;
 
+    RenderState _renderState();
+    void _drawTransformed();
     void _drawList();
 };
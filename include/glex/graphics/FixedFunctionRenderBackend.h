@@ -0,0 +1,21 @@
+#pragma once
+#include "RenderBackend.h"
+
+// Draws geometry straight from system memory with client arrays, or from display lists for static
+// geometry on PC. Client arrays are the native path for GLdc, which transforms and submits
+// vertices on the CPU anyway.
+class FixedFunctionRenderBackend : public RenderBackend {
+public:
+    Type type() override { return Type::FixedFunction; }
+    const char* name() override { return "fixed function"; }
+
+    bool initialize() override { return true; }
+
+    void drawGeometry(Geometry& geometry) override;
+    void releaseGeometry(Geometry& geometry) override;
+
+    void setColor(GLfloat r, GLfloat g, GLfloat b, GLfloat a) override;
+
+private:
+    void _drawArrays(const Geometry& geometry);
+};
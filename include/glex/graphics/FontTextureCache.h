@@ -0,0 +1,38 @@
+#pragma once
+#include "glex/common/gl.h"
+#include "Text.h"
+#include "Texture.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+
+// Font textures are uploaded alpha only and tinted with the vertex color (GL_MODULATE), so every
+// color of a face shares one texture. For GL implementations that don't modulate alpha textures
+// by the vertex color, define GLEX_TINT_FONT_TEXTURES=0 to bake each color into its own RGBA texture.
+#ifndef GLEX_TINT_FONT_TEXTURES
+#define GLEX_TINT_FONT_TEXTURES 1
+#endif
+
+/*
+ * Hands out one shared texture per font face (and per color, when not tinting) to every Text that
+ * uses it. Textures are refcounted with shared_ptr, so a texture is deleted as soon as the last
+ * Text using it deletes its texture or is destroyed.
+ */
+class FontTextureCache {
+public:
+    static std::shared_ptr<Texture> texture(FontFace face, FontColor color);
+
+    // True if Text must tint its vertex color to get the font color
+    static bool isTinted() { return GLEX_TINT_FONT_TEXTURES; }
+
+    // Number of font textures currently in VRAM
+    static size_t textureCount();
+
+private:
+    static std::map<uint32_t, std::weak_ptr<Texture>> _textures;
+
+    static uint32_t _key(FontFace face, FontColor color);
+    static std::shared_ptr<Texture> _createTexture(FontFace face, FontColor color);
+};
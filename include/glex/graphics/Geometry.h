@@ -0,0 +1,57 @@
+#pragma once
+#include "glex/common/gl.h"
+
+// Where each attribute is inside an interleaved vertex, in bytes. -1 means the attribute isn't present.
+struct VertexLayout {
+    GLsizei stride = 0;
+    int positionOffset = 0; // Always 3 floats
+    int normalOffset = -1;  // 3 floats
+    int texCoordOffset = -1; // 2 floats
+    int colorOffset = -1;   // 3 floats
+};
+
+/*
+ * Vertex (and optionally index) data that the current RenderBackend can keep on the GPU between
+ * frames. The data isn't copied, so it must stay alive while the Geometry is drawn: the fixed
+ * function backend draws straight from it, while the modern backend uploads it to buffers the
+ * first time it's drawn and again only after invalidate().
+ *
+ * Set isStatic for geometry that never changes after it's first drawn (i.e. meshes and props),
+ * which lets the fixed function backend compile it into a display list on PC.
+ *
+ * Copies share the data pointers but upload their own buffers.
+ */
+class Geometry {
+public:
+    GLenum mode = GL_TRIANGLES;
+    VertexLayout layout;
+
+    const void* vertices = nullptr;
+    GLsizei vertexCount = 0;
+    const void* indices = nullptr;  // nullptr to draw the vertices in order
+    GLsizei indexCount = 0;
+    GLenum indexType = GL_UNSIGNED_SHORT;
+    bool isStatic = false;
+
+    // Backend owned
+    GLuint vertexArray = 0;
+    GLuint vertexBuffer = 0;
+    GLuint indexBuffer = 0;
+    GLuint displayList = 0;
+    bool isDirty = true;
+
+    Geometry() {};
+    Geometry(const Geometry& other);
+    Geometry& operator=(const Geometry& other);
+    ~Geometry();
+
+    // Call after changing the data (not needed when only the pointers move), so it's uploaded again
+    void invalidate() { isDirty = true; }
+    // Draws with the current matrices and RenderState
+    void draw();
+    // Frees any GPU buffers, they're recreated if the geometry is drawn again
+    void release();
+
+private:
+    void _copyDescription(const Geometry& other);
+};
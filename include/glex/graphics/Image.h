@@ -1,6 +1,12 @@
 #pragma once
 #include "glex/common/gl.h"
+#include "RenderState.h"
+#include "Geometry.h"
 #include "Texture.h"
+#include "TextureAtlas.h"
+
+class RenderQueue;
+class SceneNode;
 
 class Image {
 public:
@@ -22,17 +28,42 @@ public:
     GLfloat rotationX = 0;
     GLfloat rotationY = 0;
     GLfloat scale = 1;
+    SceneNode* node = nullptr; // Optional, when set its world matrix replaces scale and rotation
 
     Texture* texture;
+    UVRect uv; // The part of the texture to draw, defaults to the whole texture
 
     Image() {};
     Image(Texture* texture_) { texture = texture_; };
     Image(Texture* texture_, float x_, float y_, float z_, float width_, float height_, float windowScale_, float scale_ = 1.0) {
         texture = texture_; x = x_; y = y_; z = z_; width = width_; height = height_, windowScale = windowScale_; scale = scale_;
     };
+    Image(const AtlasRegion& region, float x_, float y_, float z_, float width_, float height_, float windowScale_, float scale_ = 1.0) {
+        setRegion(region); x = x_; y = y_; z = z_; width = width_; height = height_, windowScale = windowScale_; scale = scale_;
+    };
+
+    // Draws a region of a TextureAtlas instead of a whole texture
+    void setRegion(const AtlasRegion& region) { texture = region.texture; uv = region.uv; }
     
     void draw();
+    void submit(RenderQueue& queue);
 
 private:
+    // Interleaved x, y, z, s, t for the quad's two triangles, rebuilt only when the values they
+    // were built from change so the backend can keep them on the GPU
+    GLfloat _vertices[6 * 5];
+    Geometry _geometry;
+    bool _isVerticesBuilt = false;
+    float _builtX = 0;
+    float _builtY = 0;
+    float _builtZ = 0;
+    float _builtWidth = 0;
+    float _builtHeight = 0;
+    UVRect _builtUV;
+
+    RenderState _renderState();
+    void _drawTransformed();
     void _drawList();
+    bool _isVerticesDirty();
+    void _buildVertices();
 };
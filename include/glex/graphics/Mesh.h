@@ -1,22 +1,51 @@
 #pragma once
 #include "glex/common/gl.h"
+#include "RenderState.h"
+#include "Geometry.h"
 #include "glex/common/mesh.h"
 #include "Texture.h"
 
+#include <memory>
+#include <vector>
+
+class RenderQueue;
+class SceneNode;
+
 class Mesh {
 public:
     GLfloat rotationX = 0.0;
     GLfloat rotationY = 0.0;
     GLfloat rotationZ = 0.0;
     GLfloat scale = 0.0;
+    SceneNode* node = nullptr; // Optional, when set its world matrix replaces scale and rotation
+    // Skip drawing when outside of the camera frustum. Only enable for meshes drawn straight under
+    // reshapeFrustum() or RenderQueue::setFrustum(), moving the modelview matrix in between
+    // (glTranslatef etc.) isn't taken into account.
+    bool isCullingEnabled = false;
 
+    // texture is used by the sub meshes whose material has no texture of its own (it may be NULL)
     Mesh(MeshData* meshData, Texture* texture, GLfloat scale = 1.0);
+    // Loads the diffuse texture of every material, each file once. Returns false if any failed,
+    // those sub meshes keep using the mesh's texture.
+    bool loadMaterialTextures();
+    // Overrides a material's texture (NULL to use the mesh's texture)
+    void setMaterialTexture(size_t materialIndex, Texture* texture);
     void draw();
+    void submit(RenderQueue& queue);
+    // False if the mesh's bounding sphere is entirely outside of the current camera frustum
+    bool isVisible();
 
 private:
     MeshData* _meshData;
+    std::vector<SubMesh> _subMeshes;
+    std::vector<Geometry> _geometries; // One per sub mesh
     Texture* _texture;
+    std::vector<Texture*> _materialTextures;
+    std::vector<std::shared_ptr<Texture>> _loadedTextures;
     GLfloat _scale = 1.0;
     
+    Texture* _subMeshTexture(const SubMesh& subMesh);
+    RenderState _renderState();
+    void _drawTransformed();
     void _drawList();
 };
@@ -6,4 +6,13 @@
 class MeshLoader {
 public:
     static MeshData* loadObjMesh(std::string path);
+    // Same as loadObjMesh(), but parses and indexes the file on several threads (threadCount 0 uses
+    // one per core). Worth it for big files, where a few vertices on the seams between the threads'
+    // ranges end up duplicated. Always single threaded on the Dreamcast.
+    static MeshData* loadObjMeshParallel(std::string path, unsigned threadCount = 0);
+    // Loads a .glexmesh file (see glex/common/meshfile.h), much faster than parsing an OBJ
+    static MeshData* loadBinaryMesh(std::string path);
+    // Writes a .glexmesh file. Material textures keep the names the MTL gave them, so they have to
+    // sit next to the .glexmesh file the same way they sat next to the OBJ.
+    static bool saveBinaryMesh(const MeshData* meshData, std::string path);
 };
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+#include "glex/common/gl.h"
+
+#include <cstddef>
+
+struct TextureImage;
+
+// How each mipmap level is filtered down from the one above it
+enum class MipmapFilter {
+    None,  // No mipmaps, sampled with GL_LINEAR
+    Box,   // Average of each 2x2 block, fast enough for load time
+    Kaiser // Kaiser windowed sinc over 8x8 texels, sharper distant textures for more CPU time
+};
+
+namespace glex {
+    // Size of a side at a mipmap level, halved per level down to 1
+    static inline GLsizei mipmapSize(GLsizei size, size_t level) {
+        size >>= level;
+        return size > 0 ? size : 1;
+    }
+
+    // Halve 8 bit RGB or RGBA pixels into output, mipmapSize(width, 1) x mipmapSize(height, 1).
+    // The box filter uses SSE2 for RGBA on PC, and works a word at a time elsewhere.
+    void downsampleBox(const unsigned char* pixels, int components, GLsizei width, GLsizei height, unsigned char* output);
+    void downsampleKaiser(const unsigned char* pixels, int components, GLsizei width, GLsizei height, unsigned char* output);
+
+    // Fills image.mipmaps with every level down to 1x1. Must run before Texture::convertImage(),
+    // and doesn't touch GL so it can run on any thread.
+    void generateMipmaps(TextureImage& image, MipmapFilter filter);
+}
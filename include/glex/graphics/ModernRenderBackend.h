@@ -0,0 +1,34 @@
+#pragma once
+#include "RenderBackend.h"
+
+/*
+ * GL 3.3 backend for PC: geometry is uploaded once to a vertex buffer (and index buffer) with a
+ * vertex array object, and drawn with a small set of built-in shaders that match the fixed
+ * function state GLEX uses (no lighting, vertex color modulated by the texture).
+ *
+ * It runs on a compatibility profile context so the matrix stack (glPushMatrix, glRotatef,
+ * glOrtho, ...) keeps working unchanged, and the shaders read the matrices from it. Drawing that
+ * doesn't go through Geometry (i.e. SpriteBatch) still uses client arrays without shaders.
+ */
+class ModernRenderBackend : public RenderBackend {
+public:
+    Type type() override { return Type::Modern; }
+    const char* name() override { return "GL 3.3"; }
+
+    bool initialize() override;
+
+    void drawGeometry(Geometry& geometry) override;
+    void releaseGeometry(Geometry& geometry) override;
+
+    void setColor(GLfloat r, GLfloat g, GLfloat b, GLfloat a) override;
+    void configureAlphaTexture() override;
+
+private:
+    GLuint _colorProgram = 0;
+    GLuint _textureProgram = 0;
+    GLfloat _color[4] = { 1.0, 1.0, 1.0, 1.0 };
+
+    void _upload(Geometry& geometry);
+    GLuint _createProgram(const char* vertexSource, const char* fragmentSource);
+    GLuint _compileShader(GLenum type, const char* source);
+};
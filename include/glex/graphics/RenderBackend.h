@@ -0,0 +1,44 @@
+#pragma once
+#include "glex/common/gl.h"
+
+class Geometry;
+
+/*
+ * How geometry reaches the GPU. Application::createWindow() picks the backend once the GL context
+ * exists: the fixed function backend is used on the Dreamcast (GLdc) and on old PC drivers, and
+ * the modern backend whenever a GL 3.3 context is available. Both draw with the current matrices
+ * and the state set by RenderState, so drawables don't need to know which one is in use.
+ */
+class RenderBackend {
+public:
+    enum class Type {
+        FixedFunction,
+        Modern
+    };
+
+    // The selected backend (fixed function until a window is created)
+    static RenderBackend& current();
+    // Called by Application::createWindow(). Falls back to fixed function if the backend can't
+    // be initialized, and returns the type actually selected.
+    static Type select(Type type);
+
+    virtual ~RenderBackend() {};
+    virtual Type type() = 0;
+    virtual const char* name() = 0;
+
+    // Sets up GL objects, returns false if the backend can't be used with the current context
+    virtual bool initialize() = 0;
+
+    virtual void drawGeometry(Geometry& geometry) = 0;
+    virtual void releaseGeometry(Geometry& geometry) = 0;
+
+    // The vertex color used by geometry without a color attribute
+    virtual void setColor(GLfloat r, GLfloat g, GLfloat b, GLfloat a) = 0;
+
+    // Alpha only textures (i.e. fonts) are white with alpha in the fixed function pipeline,
+    // call after uploading one so the backend samples it the same way
+    virtual void configureAlphaTexture() {};
+
+private:
+    static RenderBackend* _current;
+};
@@ -0,0 +1,80 @@
+#pragma once
+#include "glex/common/gl.h"
+#include "RenderState.h"
+#include "SpriteBatch.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Application;
+class Image;
+
+enum class Projection : uint8_t {
+    Current, // Leave whatever projection is currently set alone
+    Frustum,
+    Ortho
+};
+
+/*
+ * Collects the drawables for a frame and draws them all at once in flush(), sorted so that
+ * the fewest possible GL state changes are made.
+ *
+ * Usage mirrors immediate drawing: call setFrustum()/setOrtho() where you would have called
+ * Application::reshapeFrustum()/reshapeOrtho(), then submit() instead of draw(). Each projection
+ * call starts a new layer; layers are always drawn in the order they were created, and only the
+ * drawables within a layer are reordered. The projection calls also set Frustum::current() right
+ * away, so drawables that cull in submit() use the camera of the layer they end up in.
+ *
+ * Within a layer, opaque drawables are drawn first, grouped by texture and then front to back.
+ * Blended drawables are drawn afterwards, back to front so transparency is correct, and grouped
+ * by texture when at the same depth.
+ *
+ * Images that end up next to each other after sorting are drawn together through a SpriteBatch.
+ */
+class RenderQueue {
+public:
+    typedef void (*DrawFunction)(void* drawable);
+
+    void setFrustum();
+    void setOrtho(float scale);
+
+    // Queue a drawable for this frame. depth is between 0 (nearest) and 1 (farthest), and
+    // drawFunction is called with the drawable at flush time once the state has been applied.
+    void submit(const RenderState& state, float depth, void* drawable, DrawFunction drawFunction);
+    // Queue an Image to be drawn through the sprite batch
+    void submit(const RenderState& state, float depth, const Image& sprite);
+
+    // Sort and draw everything that was submitted, then empty the queue for the next frame
+    void flush(Application& app);
+
+    size_t size() { return _commands.size(); }
+    // Number of GL state calls issued by the last flush, including projection changes (useful for profiling)
+    size_t lastStateChanges() { return _lastStateChanges; }
+
+    // Converts an orthographic z value (see Image::Z_BACKGROUND and Image::Z_HUD) to a depth
+    static float depthForOrthoZ(float z);
+
+private:
+    struct Layer {
+        Projection projection;
+        float orthoScale;
+    };
+
+    struct Command {
+        uint64_t key;
+        RenderState state;
+        void* drawable;
+        DrawFunction drawFunction;
+        const Image* sprite;
+    };
+
+    std::vector<Layer> _layers;
+    std::vector<Command> _commands;
+    SpriteBatch _spriteBatch;
+    size_t _lastStateChanges = 0;
+
+    void _addLayer(Projection projection, float orthoScale);
+    void _addCommand(const RenderState& state, float depth, void* drawable, DrawFunction drawFunction, const Image* sprite);
+    static uint64_t _makeKey(uint16_t layer, const RenderState& state, float depth);
+};
@@ -0,0 +1,13 @@
+#pragma once
+#include "glex/common/gl.h"
+
+// The fixed-function state a drawable needs to be drawn with
+struct RenderState {
+    bool depthTest = true;
+    bool cullFace = false;
+    bool blend = false;
+    GLuint textureId = 0; // 0 means texturing is disabled
+
+    // Sets all of the state through GLStateCache, so only what actually changed reaches GL
+    void apply() const;
+};
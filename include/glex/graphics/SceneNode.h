@@ -0,0 +1,56 @@
+#pragma once
+#include "glex/common/gl.h"
+#include "glex/math/Matrix.h"
+
+#include <vector>
+
+/*
+ * A transform in a hierarchy. Each node has a local position, rotation (degrees, applied Z then Y
+ * then X like the drawables do) and scale, and caches its world matrix (parent's world matrix *
+ * local matrix). The matrices are only recomputed when the node or one of its ancestors changed
+ * since the last time they were used, so nodes that don't move cost no matrix work.
+ *
+ * Drawables with a node draw with its world matrix in place of their own scale and rotation.
+ * Nodes don't own their children, and a node removes itself from its parent and children when
+ * it's destroyed.
+ */
+class SceneNode {
+public:
+    SceneNode() {};
+    ~SceneNode();
+
+    void setPosition(float x, float y, float z);
+    void setRotation(float x, float y, float z);
+    void setScale(float x, float y, float z);
+    void setScale(float scale) { setScale(scale, scale, scale); }
+    const float* position() { return _position; }
+    const float* rotation() { return _rotation; }
+    const float* scale() { return _scale; }
+
+    SceneNode* parent() { return _parent; }
+    const std::vector<SceneNode*>& children() { return _children; }
+    void addChild(SceneNode* child);
+    void removeChild(SceneNode* child);
+
+    // Column major, ready for glMultMatrixf
+    const Matrix4& localMatrix();
+    const Matrix4& worldMatrix();
+
+private:
+    SceneNode* _parent = nullptr;
+    std::vector<SceneNode*> _children;
+
+    float _position[3] = { 0, 0, 0 };
+    float _rotation[3] = { 0, 0, 0 };
+    float _scale[3] = { 1, 1, 1 };
+
+    Matrix4 _localMatrix;
+    Matrix4 _worldMatrix;
+    bool _isLocalDirty = true;
+    bool _isWorldDirty = true;
+
+    SceneNode(SceneNode const&);         // Prevent copies
+    void operator=(SceneNode const&);    // Prevent assignments
+    void _setLocalDirty();
+    void _setWorldDirty();
+};
@@ -0,0 +1,44 @@
+#pragma once
+#include "glex/common/gl.h"
+
+#include <cstddef>
+#include <vector>
+
+class Image;
+
+/*
+ * Draws many Images with one glDrawArrays call per run of Images that share a texture.
+ *
+ * Each Image's scale and rotation are applied on the CPU as it's added, so there is no matrix
+ * stack work per Image. Images are drawn in the order they were added (which matters for
+ * blending), so add Images that share a texture next to each other to get the fewest draws.
+ * The vertex buffer keeps its capacity between frames, so after the first frame adding Images
+ * doesn't allocate.
+ */
+class SpriteBatch {
+public:
+    void add(const Image& image);
+
+    // Draws everything added since the last draw, then empties the batch
+    void draw();
+    void clear();
+
+    size_t size() { return _vertices.size() / VERTEX_SIZE / VERTICES_PER_SPRITE; }
+    // Number of glDrawArrays calls made by the last draw (useful for profiling)
+    size_t lastDrawCalls() { return _lastDrawCalls; }
+
+private:
+    // Interleaved x, y, z, s, t
+    static constexpr size_t VERTEX_SIZE = 5;
+    static constexpr size_t VERTICES_PER_SPRITE = 6;
+
+    struct Run {
+        GLuint textureId;
+        GLint first;
+        GLsizei count;
+    };
+
+    std::vector<GLfloat> _vertices;
+    std::vector<Run> _runs;
+    size_t _lastDrawCalls = 0;
+};
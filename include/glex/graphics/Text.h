@@ -1,9 +1,16 @@
 #pragma once
 #include "glex/common/gl.h"
+#include "RenderState.h"
+#include "Geometry.h"
 #include "glex/common/font.h"
 #include "Texture.h"
 
+#include <memory>
 #include <string>
+#include <vector>
+
+class RenderQueue;
+class SceneNode;
 
 enum class FontFace {
     arial_16,
@@ -11,6 +18,9 @@ enum class FontFace {
     arial_32
 };
 
+// The built-in font data for a face. Fonts are shared by every Text using them, so they're read only.
+const texture_font_t* textureFontForFace(FontFace face);
+
 struct FontColor {
     uint8_t r;
     uint8_t g;
@@ -34,21 +44,41 @@ public:
     GLfloat rotationX = 0;
     GLfloat rotationY = 0;
     float scale = 1;
+    SceneNode* node = nullptr; // Optional, when set its world matrix replaces scale and rotation
     float kerning = 0; // TODO: Figure out sane default value
 
     std::string text;
-    const FontColor& color = _color;
-    const Texture& texture = _texture; // Texture object referencing the internal font texture
+    FontColor color; // When font textures are tinted (see FontTextureCache) this can be changed at any time
+
+    // The font texture, shared with every other Text using the same face (and color, if not tinted)
+    std::shared_ptr<Texture> texture() { return _texture; }
 
     Text(FontFace face, std::string text_, FontColor color_, float x_, float y_, float z_, float windowScale_, float scale_ = 1.0, float kerning_ = 0.0);
     ~Text();
     void createTexture();
     void deleteTexture();
     void draw();
+    void submit(RenderQueue& queue);
 private:
-    FontColor _color;
-    texture_font_t _font;
-    Texture _texture;
+    FontFace _face;
+    const texture_font_t* _font;
+    std::shared_ptr<Texture> _texture;
+
+    // Glyph quads for the whole string as interleaved x, y, z, s, t, rebuilt only when
+    // the values they were built from change
+    std::vector<GLfloat> _vertices;
+    Geometry _geometry;
+    bool _isVerticesBuilt = false;
+    std::string _builtText;
+    float _builtX = 0;
+    float _builtY = 0;
+    float _builtZ = 0;
+    float _builtKerning = 0;
+    const texture_font_t* _builtFont = nullptr;
 
+    RenderState _renderState();
+    void _drawTransformed();
     void _drawList();
+    bool _isVerticesDirty();
+    void _buildVertices();
 };
@@ -1,26 +1,79 @@
 #pragma once
 #include "glex/common/gl.h"
+#include "TextureFormat.h"
+#include "Mipmap.h"
 
 #include <string>
+#include <vector>
+
+// A rectangle in texture coordinates, from the bottom left (s0, t0) to the top right (s1, t1)
+struct UVRect {
+    GLfloat s0 = 0;
+    GLfloat t0 = 0;
+    GLfloat s1 = 1;
+    GLfloat t1 = 1;
+};
+
+// Pixels decoded from an image file, ready to upload. Decoding doesn't touch GL, so it can run on
+// any thread (see AssetLoader).
+struct TextureImage {
+    GLsizei width = 0;
+    GLsizei height = 0;
+    int components = 0; // 3 for RGB, 4 for RGBA (as decoded, also after converting)
+    TextureFormat format = TextureFormat::Default; // Set by Texture::convertImage()
+    bool isTwiddled = false; // Set by glex::compressImage() (see TextureCompression.h)
+    bool isVQ = false;
+    std::vector<unsigned char> pixels;
+    std::vector<std::vector<unsigned char>> mipmaps; // Levels 1 and up (see glex::generateMipmaps()), in the same format
+};
 
 class Texture {
 public:
     GLuint id = 0;
+    // Set before loading to build mipmaps on the CPU, which are sampled with GL_LINEAR_MIPMAP_NEAREST
+    MipmapFilter mipmapFilter = MipmapFilter::None;
     int width() { return _width; }
     int height() { return _height; }
+    // VRAM used by the pixels, 0 for textures created outside of Texture (see loadExisting())
+    size_t byteSize() { return _byteSize; }
+
+    TextureFormat format() { return _format; }
 
     ~Texture();
-    bool loadRGBA(std::string path);
+    // Pass a 16 bit format to convert the image before uploading it (see TextureFormat)
+    bool loadRGBA(std::string path, TextureFormat format = TextureFormat::Default, bool dither = true);
     bool loadRGBA(GLsizei textureWidth, GLsizei textureHeight, const unsigned char* rgbaData);
-    bool loadRGB(std::string path);
+    bool loadRGB(std::string path, TextureFormat format = TextureFormat::Default, bool dither = true);
     bool loadRGB(GLsizei textureWidth, GLsizei textureHeight, const unsigned char* rgbData);
+    // Uploads pixels already packed in one of the 16 bit formats
+    bool loadPacked(GLsizei textureWidth, GLsizei textureHeight, TextureFormat format, const uint16_t* packedData);
+    // Loads a .glextex file made by GLEXTextureConverter. The Dreamcast uploads its twiddled or VQ
+    // compressed pixels as they are, PC converts them back to linear 16 bit pixels first.
+    bool loadCompressed(std::string path);
     bool loadExisting(GLsizei textureWidth, GLsizei textureHeight, GLuint textureId);
+    // Uploads a decoded image as RGB, RGBA, or in the format it was converted or compressed to
+    bool loadImage(const TextureImage& image);
     void unload();
     bool isLoaded();
 
+    // Decodes a JPG, PNG or BMP file with 3 (RGB) or 4 (RGBA) components, flipped to match GL's
+    // bottom up rows. Thread safe, returns false if the file can't be read.
+    static bool decodeFile(std::string path, int numberOfColorComponents, TextureImage& image, bool flipVertically = true);
+    // Packs a decoded image into a 16 bit format in place, also thread safe
+    static void convertImage(TextureImage& image, TextureFormat format, bool dither = true);
+
 private:
     GLsizei _width = 0;
     GLsizei _height = 0;
+    size_t _byteSize = 0;
+    TextureFormat _format = TextureFormat::Default;
 
-    bool _loadTextureFromFile(std::string path, int numberOfColorComponents, bool flipVertically = true);
+    bool _loadPixels(GLsizei textureWidth, GLsizei textureHeight, int components, const unsigned char* pixels);
+    bool _loadPacked(GLsizei textureWidth, GLsizei textureHeight, TextureFormat format, const uint16_t* packedData,
+                     const std::vector<std::vector<unsigned char>>* mipmaps);
+    bool _upload(GLint internalFormat, GLenum pixelFormat, GLenum pixelType, size_t bytesPerPixel,
+                 GLsizei textureWidth, GLsizei textureHeight, const void* pixels,
+                 const std::vector<std::vector<unsigned char>>* mipmaps);
+    bool _loadTwiddled(const TextureImage& image);
+    bool _loadTextureFromFile(std::string path, int numberOfColorComponents, TextureFormat format, bool dither, bool flipVertically = true);
 };
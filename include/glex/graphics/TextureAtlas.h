@@ -0,0 +1,84 @@
+#pragma once
+#include "glex/common/gl.h"
+#include "Texture.h"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Where an image ended up in a TextureAtlas
+struct AtlasRegion {
+    Texture* texture = nullptr; // The atlas page, owned by the atlas
+    size_t page = 0;            // Index of the page in pages()
+    UVRect uv;
+    GLsizei width = 0;  // Size of the image in pixels
+    GLsizei height = 0;
+};
+
+/*
+ * Packs many small images (i.e. UI icons) into a few power of two textures, so Images using them
+ * share a texture and batch into one draw instead of one bind each. Add every image, build() once,
+ * then point Images at their regions with Image::setRegion().
+ *
+ * Images are packed with a skyline bottom left packer, tallest first, into pages of up to
+ * maxPageSize. Each image gets padding pixels around it copied from its edges, so linear filtering
+ * doesn't bleed in its neighbors. The last page shrinks to the smallest power of two that fits.
+ */
+class TextureAtlas {
+public:
+    TextureAtlas(GLsizei maxPageSize = 512, GLsizei padding = 1, TextureFormat format = TextureFormat::Default, bool dither = true);
+
+    // Queues an image and returns its index for region(), or -1 if it can't be decoded
+    int add(std::string path);
+    // Queues a decoded 8 bit RGB or RGBA image
+    int add(const TextureImage& image);
+
+    // Packs and uploads everything queued, then frees the queued pixels. Returns false if an image
+    // doesn't fit in a page. Images can't be added afterwards.
+    bool build();
+    // Packs like build() but returns the 8 bit RGBA pages instead of uploading them, so it runs
+    // without GL (i.e. to bake atlases in a tool). Fills the regions except for their textures.
+    bool buildImages(std::vector<TextureImage>& pageImages);
+
+    // Valid after build()
+    const AtlasRegion& region(int index) { return _entries[index].region; }
+    size_t pageCount() { return _pages.size(); }
+    const std::vector<std::shared_ptr<Texture>>& pages() { return _pages; }
+
+private:
+    static constexpr size_t NO_PAGE = (size_t)-1; // Not packed yet
+
+    struct _Entry {
+        TextureImage image;
+        AtlasRegion region;
+        size_t page = NO_PAGE;
+        GLsizei x = 0; // Of the image itself, inside the padding
+        GLsizei y = 0;
+    };
+
+    // A horizontal span of the packed area's top edge
+    struct _SkylineSegment {
+        GLsizei x;
+        GLsizei y;
+        GLsizei width;
+    };
+
+    GLsizei _maxPageSize;
+    GLsizei _padding;
+    TextureFormat _format;
+    bool _dither;
+    std::vector<_Entry> _entries;
+    std::vector<std::shared_ptr<Texture>> _pages;
+    bool _isBuilt = false;
+
+    TextureAtlas(TextureAtlas const&);    // Prevent copies
+    void operator=(TextureAtlas const&); // Prevent assignments
+    typedef std::function<bool(TextureImage& pageImage)> _PageCallback;
+
+    static bool _insert(std::vector<_SkylineSegment>& skyline, GLsizei pageSize, GLsizei width, GLsizei height, GLsizei& x, GLsizei& y);
+    // Packs every entry, handing each page to onPage as soon as it's full so only one is in memory
+    bool _pack(const _PageCallback& onPage);
+    void _composePage(size_t page, GLsizei usedWidth, GLsizei usedHeight, TextureImage& pageImage);
+};
@@ -0,0 +1,59 @@
+#pragma once
+#include "glex/common/gl.h"
+#include "Texture.h"
+#include "TextureFormat.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/*
+ * Twiddling and VQ compression for the PVR's native texture layouts, and the .glextex files that
+ * store them (see glex/common/texturefile.h). Nothing here touches GL, so the encoders run in the
+ * GLEXTextureConverter host tool and the decoders let PC builds load the same files.
+ *
+ * Twiddled textures store texels in Morton order, which the PVR samples much faster than linear
+ * ones: each 2x2 block of texels is contiguous, then each 2x2 block of blocks, and so on.
+ * Both sides must be powers of two from 8 to 1024, and VQ textures must also be square.
+ */
+namespace glex {
+    static constexpr size_t VQ_CODEBOOK_ENTRIES = 256;
+    static constexpr size_t VQ_CODEBOOK_SIZE = VQ_CODEBOOK_ENTRIES * 4 * sizeof(uint16_t);
+
+    // Index of texel (x, y) in a twiddled texture. y goes in the low bit of each pair, and
+    // rectangular textures are a row or column of twiddled squares.
+    static inline uint32_t twiddledIndex(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+        uint32_t size = width < height ? width : height;
+        uint32_t index = 0;
+        for (uint32_t bit = 0; (1u << bit) < size; bit++) {
+            index |= ((y >> bit) & 1) << (2 * bit);
+            index |= ((x >> bit) & 1) << (2 * bit + 1);
+        }
+        return index + (x / size + y / size) * size * size;
+    }
+
+    bool isTwiddleSizeValid(GLsizei width, GLsizei height);
+    void twiddle(const uint16_t* pixels, GLsizei width, GLsizei height, uint16_t* output);
+    void untwiddle(const uint16_t* twiddled, GLsizei width, GLsizei height, uint16_t* output);
+
+    // Size of the codebook and indices of a VQ texture
+    static inline size_t vqDataSize(GLsizei width, GLsizei height) {
+        return VQ_CODEBOOK_SIZE + (size_t)width * height / 4;
+    }
+    // Builds a codebook for the 2x2 blocks of an 8 bit RGB or RGBA image with k-means, in
+    // iterations passes over the image, and packs it into format. Slow, meant for the tools.
+    // Never dithered: each codebook entry is shared by blocks all over the image, so there's no
+    // single position to take a dither pattern from.
+    bool encodeVQ(const TextureImage& image, TextureFormat format, std::vector<unsigned char>& output, int iterations = 8);
+    // Expands VQ data back to linear 16 bit pixels
+    void decodeVQ(const unsigned char* data, GLsizei width, GLsizei height, uint16_t* output);
+
+    // Converts a decoded 8 bit image in place to twiddled (and optionally VQ compressed) 16 bit
+    // pixels, as the PVR samples them. Returns false if the size can't be twiddled. dither only
+    // applies without vq, see encodeVQ().
+    bool compressImage(TextureImage& image, TextureFormat format, bool vq, bool dither = true);
+
+    // Reads and writes .glextex files, with the pixels left as stored
+    bool readTextureFile(std::string path, TextureImage& image);
+    bool writeTextureFile(const TextureImage& image, std::string path);
+}
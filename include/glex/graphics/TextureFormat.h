@@ -0,0 +1,32 @@
+#pragma once
+#include "glex/common/gl.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * How a texture is stored in VRAM. The 16 bit formats are the PVR's native texture formats and
+ * take half the memory (and upload time) of 32 bit RGBA, at the cost of banding in gradients,
+ * which ordered dithering hides well at the Dreamcast's resolution.
+ */
+enum class TextureFormat {
+    Default,  // As decoded, 24 bit RGB or 32 bit RGBA
+    RGB565,   // No alpha
+    ARGB4444, // Smooth alpha, i.e. for sprites with soft edges
+    ARGB1555  // 1 bit alpha, for cutouts. Alpha below 128 is transparent.
+};
+
+namespace glex {
+    // Bytes per pixel of a format loaded from an image with 3 (RGB) or 4 (RGBA) components
+    static inline size_t textureBytesPerPixel(TextureFormat format, int components) {
+        return format == TextureFormat::Default ? (size_t)components : 2;
+    }
+
+    // The format and type to pass to glTexImage2D() for the 16 bit formats
+    void textureFormatGLTypes(TextureFormat format, GLenum& pixelFormat, GLenum& pixelType);
+
+    // Packs 8 bit RGB or RGBA pixels into one of the 16 bit formats, optionally with a 4x4 ordered
+    // dither on the color channels. Uses SSE2 on PC and works a word at a time elsewhere.
+    void convertPixels(const unsigned char* pixels, int components, GLsizei width, GLsizei height,
+                       TextureFormat format, bool dither, uint16_t* output);
+}
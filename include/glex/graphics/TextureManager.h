@@ -0,0 +1,40 @@
+#pragma once
+#include "Texture.h"
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+
+/*
+ * Hands out one shared texture per image file, so meshes and images using the same file don't
+ * decode it and take up VRAM again. Paths are resolved with glex::targetPlatformPath() first, so
+ * "images/wood1.bmp" and its /cd or /pc path are the same texture. Textures are refcounted with
+ * shared_ptr and unloaded as soon as the last user releases theirs.
+ *
+ * Must be used from the GL thread.
+ */
+class TextureManager {
+public:
+    // Returns nullptr if the file can't be loaded. The same file in different formats are
+    // different textures.
+    static std::shared_ptr<Texture> loadRGBA(std::string path, TextureFormat format = TextureFormat::Default, bool dither = true,
+                                             MipmapFilter mipmapFilter = MipmapFilter::None);
+    static std::shared_ptr<Texture> loadRGB(std::string path, TextureFormat format = TextureFormat::Default, bool dither = true,
+                                            MipmapFilter mipmapFilter = MipmapFilter::None);
+
+    // Number of managed textures currently loaded, and the VRAM they use
+    static size_t textureCount() { return _textures.size(); }
+    static size_t bytesResident() { return _bytesResident; }
+    // Number of users of a loaded texture, 0 if it isn't loaded
+    static long referenceCount(std::string path, bool hasAlpha = true, TextureFormat format = TextureFormat::Default, bool dither = true,
+                               MipmapFilter mipmapFilter = MipmapFilter::None);
+
+private:
+    static std::map<std::string, std::weak_ptr<Texture>> _textures;
+    static size_t _bytesResident;
+
+    static std::string _key(const std::string& platformPath, int components, TextureFormat format, bool dither, MipmapFilter mipmapFilter);
+    static std::shared_ptr<Texture> _load(std::string path, int components, TextureFormat format, bool dither, MipmapFilter mipmapFilter);
+    static void _release(std::string key, Texture* texture, size_t byteSize);
+};
@@ -1,5 +1,10 @@
 #pragma once
 #include "glex/common/gl.h"
+#include "RenderState.h"
+#include "Geometry.h"
+
+class RenderQueue;
+class SceneNode;
 
 class Triangle {
 public:
@@ -13,6 +18,7 @@ public:
     GLfloat rotationX = 0;
     GLfloat rotationY = 0;
     GLfloat scale = 1;
+    SceneNode* node = nullptr; // Optional, when set its world matrix replaces scale and rotation
 
     Triangle() {};
     Triangle(float x_, float y_, float z_, float width_, float height_, float windowScale_, float scale_ = 1.0) {
@@ -20,7 +26,22 @@ public:
     };
     
     void draw();
+    void submit(RenderQueue& queue);
     
 private:
+    // Interleaved x, y, z, r, g, b, rebuilt only when the values they were built from change
+    GLfloat _vertices[3 * 6];
+    Geometry _geometry;
+    bool _isVerticesBuilt = false;
+    float _builtX = 0;
+    float _builtY = 0;
+    float _builtZ = 0;
+    float _builtWidth = 0;
+    float _builtHeight = 0;
+
+    RenderState _renderState();
+    void _drawTransformed();
     void _drawList();
+    bool _isVerticesDirty();
+    void _buildVertices();
 };
@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Sine and cosine for per frame rotations, where libm's full precision isn't needed.
+ *
+ * On the Dreamcast this is the SH4 fsca instruction, which computes both at once in a few cycles
+ * with the angle quantized to 1/65536 of a turn. Elsewhere it linearly interpolates a 1024 entry
+ * table of one full turn, with a maximum absolute error of about 7e-6 compared to sinf/cosf (run
+ * GLEXBenchmark to measure it), i.e. far below a pixel for any on screen rotation.
+ *
+ * Any angle works, there is no need to wrap it to 0-360 first.
+ */
+namespace glex {
+    // Angle in degrees, the same as glRotatef takes
+    void fastSinCos(float degrees, float& sine, float& cosine);
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include "Vector.h"
+
+#include <cstddef>
+
+/*
+ * 4x4 matrix in column major order, the same layout as the GL matrix stack, so data() can be
+ * passed straight to glLoadMatrixf/glMultMatrixf.
+ *
+ * Multiplication and transforming vectors use SSE on PC and the SH4 matrix unit (ftrv) on the
+ * Dreamcast, with a plain C++ fallback for anything else. The builders match what the GL calls of
+ * the same name do to the current matrix, i.e. m.rotate(...) is m = m * rotation like glRotatef.
+ */
+struct alignas(8) Matrix4 {
+    float m[16];
+
+    Matrix4() { setIdentity(); }
+
+    static Matrix4 identity() { return Matrix4(); }
+    static Matrix4 frustum(float left, float right, float bottom, float top, float zNear, float zFar);
+    static Matrix4 ortho(float left, float right, float bottom, float top, float zNear, float zFar);
+    static Matrix4 translation(float x, float y, float z);
+    static Matrix4 scaling(float x, float y, float z);
+    // Angle in degrees around the normalized axis (x, y, z)
+    static Matrix4 rotation(float angle, float x, float y, float z);
+    // Same as rotating around Z, then Y, then X (degrees) like three glRotatef calls, but built in
+    // one step with glex::fastSinCos(). Angles that are 0 cost nothing.
+    static Matrix4 rotationZYX(float x, float y, float z);
+
+    void setIdentity();
+    void translate(float x, float y, float z);
+    void scale(float x, float y, float z);
+    void rotate(float angle, float x, float y, float z);
+    void rotateZYX(float x, float y, float z);
+
+    Matrix4 operator*(const Matrix4& other) const;
+    Vector4 operator*(const Vector4& v) const;
+    // Transforms (x, y, z, 1) and drops w
+    Vector3 transformPoint(const Vector3& point) const;
+    // Transforms count points at once (in and out may be the same array)
+    void transformPoints(const Vector3* in, Vector3* out, size_t count) const;
+
+    Matrix4 transposed() const;
+    // Length of the longest of the x, y and z axes, i.e. how much it scales a bounding sphere
+    float maxAxisScale() const;
+
+    const float* data() const { return m; }
+    float& operator()(int row, int column) { return m[column * 4 + row]; }
+    float operator()(int row, int column) const { return m[column * 4 + row]; }
+
+    // Plain C++ versions of the SIMD operations, to check them against
+    static Matrix4 multiplyReference(const Matrix4& a, const Matrix4& b);
+    static Vector4 transformReference(const Matrix4& matrix, const Vector4& v);
+};
@@ -0,0 +1,29 @@
+#pragma once
+#include "Vector.h"
+#include "Matrix.h"
+
+// Unit quaternion rotation. Composes like matrices: (a * b) rotates by b and then by a.
+struct Quaternion {
+    float x = 0;
+    float y = 0;
+    float z = 0;
+    float w = 1;
+
+    Quaternion() {};
+    Quaternion(float x_, float y_, float z_, float w_) { x = x_; y = y_; z = z_; w = w_; }
+
+    // Angle in degrees around the normalized axis
+    static Quaternion fromAxisAngle(const Vector3& axis, float angle);
+    // Degrees, applied Z then Y then X like glRotatef calls in that order (and SceneNode)
+    static Quaternion fromEuler(float x, float y, float z);
+
+    Quaternion operator*(const Quaternion& other) const;
+    Quaternion conjugate() const { return Quaternion(-x, -y, -z, w); }
+    Quaternion normalized() const;
+
+    Vector3 rotate(const Vector3& v) const;
+    Matrix4 toMatrix() const;
+
+    // Spherical interpolation, t from 0 (a) to 1 (b), along the shortest path
+    static Quaternion slerp(const Quaternion& a, const Quaternion& b, float t);
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+struct Vector3 {
+    float x = 0;
+    float y = 0;
+    float z = 0;
+
+    Vector3() {};
+    Vector3(float x_, float y_, float z_) { x = x_; y = y_; z = z_; }
+
+    Vector3 operator+(const Vector3& other) const { return Vector3(x + other.x, y + other.y, z + other.z); }
+    Vector3 operator-(const Vector3& other) const { return Vector3(x - other.x, y - other.y, z - other.z); }
+    Vector3 operator*(float scale) const { return Vector3(x * scale, y * scale, z * scale); }
+    Vector3 operator-() const { return Vector3(-x, -y, -z); }
+
+    float dot(const Vector3& other) const;
+    Vector3 cross(const Vector3& other) const {
+        return Vector3(y * other.z - z * other.y, z * other.x - x * other.z, x * other.y - y * other.x);
+    }
+    float length() const;
+    float lengthSquared() const { return dot(*this); }
+    // Returns the zero vector for the zero vector
+    Vector3 normalized() const;
+};
+
+struct Vector4 {
+    float x = 0;
+    float y = 0;
+    float z = 0;
+    float w = 0;
+
+    Vector4() {};
+    Vector4(float x_, float y_, float z_, float w_) { x = x_; y = y_; z = z_; w = w_; }
+    Vector4(const Vector3& v, float w_) { x = v.x; y = v.y; z = v.z; w = w_; }
+
+    Vector4 operator+(const Vector4& other) const { return Vector4(x + other.x, y + other.y, z + other.z, w + other.w); }
+    Vector4 operator-(const Vector4& other) const { return Vector4(x - other.x, y - other.y, z - other.z, w - other.w); }
+    Vector4 operator*(float scale) const { return Vector4(x * scale, y * scale, z * scale, w * scale); }
+
+    Vector3 xyz() const { return Vector3(x, y, z); }
+    float dot(const Vector4& other) const;
+    float length() const;
+    // Returns the zero vector for the zero vector
+    Vector4 normalized() const;
+
+    // Plain C++ versions of the SIMD operations, to check them against
+    static float dotReference(const Vector4& a, const Vector4& b);
+    static Vector4 normalizedReference(const Vector4& v);
+};
@@ -1,6 +1,26 @@
 #include "glex/Application.h"
+#include "glex/AssetLoader.h"
 #include "glex/common/gl.h"
 #include "glex/common/log.h"
+#include "glex/math/Matrix.h"
+
+Application::Application() {}
+
+// Defined here where AssetLoader is complete
+Application::~Application() {}
+
+AssetLoader& Application::assetLoader() {
+    if (!_assetLoader) {
+        _assetLoader.reset(new AssetLoader());
+    }
+    return *_assetLoader;
+}
+
+void Application::_processAssetUploads() {
+    if (_assetLoader) {
+        _assetLoader->processUploads(assetUploadBudget);
+    }
+}
 
 void Application::_reshapeFrustum(int width, int height) {
     GLfloat h = (GLfloat)height / (GLfloat)width;
@@ -17,6 +37,12 @@ void Application::_reshapeFrustum(int width, int height) {
     glMatrixMode(GL_MODELVIEW);
     glLoadIdentity();
     glTranslatef(0.5, 0.5, -20.0);
+
+    // Keep the same camera on the CPU so drawables can be culled before any GL calls
+    Matrix4 projection = Matrix4::frustum(-xmax, xmax, -xmax * h, xmax * h, znear, zfar);
+    Matrix4 modelView = Matrix4::translation(0.5, 0.5, -20.0);
+    _frustum = Frustum::fromMatrix((projection * modelView).data());
+    Frustum::setCurrent(_frustum);
 }
 
 void Application::_reshapeOrtho(int width, int height) {
@@ -26,6 +52,9 @@ void Application::_reshapeOrtho(int width, int height) {
     glMatrixMode(GL_MODELVIEW);
     glLoadIdentity();
     glTranslatef(0.0, 0.0, 0.0);
+
+    // The camera frustum doesn't apply to anything drawn from here on
+    Frustum::clearCurrent();
 }
 
 void Application::reshapeFrustum() {
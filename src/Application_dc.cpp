@@ -3,6 +3,7 @@
 #include "glex/Application.h"
 #include "glex/common/gl.h"
 #include "glex/common/log.h"
+#include "glex/graphics/RenderBackend.h"
 
 #include <cstdlib>
 #include <algorithm>
@@ -13,6 +14,8 @@ void Application::createWindow(std::string windowName, int width, int height) {
     _windowHeight = height;
 
     glKosInit();
+    GLStateCache::invalidate();
+    RenderBackend::select(RenderBackend::Type::FixedFunction);
     _reshapeFrustum(width, height);
 }
 
@@ -22,6 +25,8 @@ void Application::closeWindow() {
 
 void Application::swapBuffers() {
     glKosSwapBuffers();
+    GLStateCache::endFrame();
+    _processAssetUploads();
 }
 
 void Application::handleInput() {
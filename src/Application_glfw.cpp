@@ -3,6 +3,7 @@
 #include "glex/Application.h"
 #include "glex/common/gl.h"
 #include "glex/common/log.h"
+#include "glex/graphics/RenderBackend.h"
 
 #include <algorithm>
 #include <cstdlib>
@@ -17,10 +18,23 @@ void Application::createWindow(std::string windowName, int width, int height) {
         exit( EXIT_FAILURE );
     }
 
-    glfwWindowHint(GLFW_DEPTH_BITS, 16);
-    glfwWindowHint(GLFW_TRANSPARENT_FRAMEBUFFER, GLFW_TRUE);
-
-    _window = glfwCreateWindow(width, height, _windowName.c_str(), NULL, NULL);
+    // Ask for a GL 3.3 compatibility context for the modern render backend (compatibility so
+    // the matrix stack still works), and fall back to whatever the driver gives by default
+    _setWindowHints();
+    if (modernRendererEnabled) {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_COMPAT_PROFILE);
+        _window = glfwCreateWindow(width, height, _windowName.c_str(), NULL, NULL);
+        if (!_window) {
+            DEBUG_PRINTLN("GL 3.3 compatibility context not available");
+            glfwDefaultWindowHints();
+            _setWindowHints();
+        }
+    }
+    if (!_window) {
+        _window = glfwCreateWindow(width, height, _windowName.c_str(), NULL, NULL);
+    }
     if (!_window) {
         fprintf(stderr, "Failed to open GLFW window\n");
         glfwTerminate();
@@ -35,6 +49,8 @@ void Application::createWindow(std::string windowName, int width, int height) {
     glfwMakeContextCurrent(_window);
     gladLoadGL(glfwGetProcAddress);
     glfwSwapInterval(vsyncEnabled ? 1 : 0);
+    GLStateCache::invalidate();
+    RenderBackend::select(modernRendererEnabled ? RenderBackend::Type::Modern : RenderBackend::Type::FixedFunction);
 
     // Setup the frame buffer and view port size
     _reshapeFrustum(width, height);
@@ -47,6 +63,11 @@ void Application::createWindow(std::string windowName, int width, int height) {
     DEBUG_PRINTLN("screen scale detected: %f", screenScale);
 }
 
+void Application::_setWindowHints() {
+    glfwWindowHint(GLFW_DEPTH_BITS, 16);
+    glfwWindowHint(GLFW_TRANSPARENT_FRAMEBUFFER, GLFW_TRUE);
+}
+
 void Application::closeWindow() {
     // Terminate GLFW
     glfwTerminate();
@@ -57,6 +78,8 @@ void Application::closeWindow() {
 
 void Application::swapBuffers() {
     glfwSwapBuffers(_window);
+    GLStateCache::endFrame();
+    _processAssetUploads();
 }
 
 void Application::handleInput() {
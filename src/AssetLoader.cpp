@@ -0,0 +1,239 @@
+#include "glex/AssetLoader.h"
+#include "glex/graphics/MeshLoader.h"
+#include "glex/graphics/TextureCompression.h"
+#include "glex/common/log.h"
+
+#include <chrono>
+
+#ifdef DREAMCAST
+void* _assetLoaderThread(void* loader) {
+    static_cast<AssetLoader*>(loader)->_workerLoop();
+    return nullptr;
+}
+#endif
+
+static bool _hasSuffix(const std::string& string, const std::string& suffix) {
+    return string.size() >= suffix.size() && string.compare(string.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+AssetLoader::AssetLoader(unsigned workerCount) {
+#ifdef DREAMCAST
+    // A single worker is plenty as it's mostly waiting on the disc, and it only gets CPU time
+    // when the main thread is waiting on something too
+    if (workerCount == 0) workerCount = 1;
+    mutex_init(&_mutex, MUTEX_TYPE_NORMAL);
+    cond_init(&_condition);
+    for (unsigned i = 0; i < workerCount; i++) {
+        kthread_t* thread = thd_create(0, _assetLoaderThread, this);
+        if (thread == nullptr) {
+            ERROR_PRINTLN("AssetLoader - Failed to create worker thread %u", i);
+            continue;
+        }
+        thd_set_prio(thread, PRIO_DEFAULT + 1);
+        _threads.push_back(thread);
+    }
+#else
+    if (workerCount == 0) {
+        unsigned cores = std::thread::hardware_concurrency();
+        workerCount = cores > 1 ? cores - 1 : 1;
+    }
+    for (unsigned i = 0; i < workerCount; i++) {
+        _threads.emplace_back(&AssetLoader::_workerLoop, this);
+    }
+#endif
+    DEBUG_PRINTLN("AssetLoader - Started %u worker threads", (unsigned)_threads.size());
+}
+
+AssetLoader::~AssetLoader() {
+    _lock();
+    _isStopping = true;
+#ifdef DREAMCAST
+    cond_broadcast(&_condition);
+#else
+    _condition.notify_all();
+#endif
+    _unlock();
+
+#ifdef DREAMCAST
+    for (kthread_t* thread : _threads) {
+        thd_join(thread, nullptr);
+    }
+    cond_destroy(&_condition);
+    mutex_destroy(&_mutex);
+#else
+    for (std::thread& thread : _threads) {
+        thread.join();
+    }
+#endif
+
+    // Nothing can run these anymore, so don't leave anyone polling forever
+    for (Job& job : _decodeJobs) {
+        job.handle->_state.store(AssetState::Failed, std::memory_order_release);
+    }
+    for (Job& job : _uploadJobs) {
+        job.handle->_state.store(AssetState::Failed, std::memory_order_release);
+    }
+}
+
+std::shared_ptr<AssetHandle<Texture>> AssetLoader::loadTexture(std::string path, bool hasAlpha, TextureFormat format, bool dither, MipmapFilter mipmapFilter) {
+    auto handle = std::make_shared<AssetHandle<Texture>>();
+    handle->_path = path;
+
+    _queueDecode(handle, [this, handle, hasAlpha, format, dither, mipmapFilter]() {
+        auto image = std::make_shared<TextureImage>();
+        if (_hasSuffix(handle->_path, ".glextex")) {
+            if (!glex::readTextureFile(handle->_path, *image)) {
+                _finish(*handle, false);
+                return;
+            }
+        } else {
+            if (!Texture::decodeFile(handle->_path, hasAlpha ? 4 : 3, *image)) {
+                _finish(*handle, false);
+                return;
+            }
+            glex::generateMipmaps(*image, mipmapFilter);
+            Texture::convertImage(*image, format, dither);
+        }
+
+        _queueUpload(handle, [this, handle, image]() {
+            auto texture = std::make_shared<Texture>();
+            bool success = texture->loadImage(*image);
+            if (success) handle->_asset = texture;
+            _finish(*handle, success);
+        });
+    });
+    return handle;
+}
+
+std::shared_ptr<AssetHandle<MeshData>> AssetLoader::loadMesh(std::string path) {
+    auto handle = std::make_shared<AssetHandle<MeshData>>();
+    handle->_path = path;
+
+    _queueDecode(handle, [this, handle]() {
+        MeshData* meshData;
+        if (_hasSuffix(handle->_path, ".glexmesh")) {
+            meshData = MeshLoader::loadBinaryMesh(handle->_path);
+        } else {
+            meshData = MeshLoader::loadObjMesh(handle->_path);
+        }
+        if (meshData != nullptr) handle->_asset = std::shared_ptr<MeshData>(meshData);
+        _finish(*handle, meshData != nullptr);
+    });
+    return handle;
+}
+
+#ifdef DREAMCAST
+std::shared_ptr<AssetHandle<Audio>> AssetLoader::loadAudio(std::string path) {
+    auto handle = std::make_shared<AssetHandle<Audio>>();
+    handle->_path = path;
+
+    _queueDecode(handle, [this, handle]() {
+        auto audio = std::make_shared<Audio>(handle->_path);
+        bool success = audio->load();
+        if (success) handle->_asset = audio;
+        _finish(*handle, success);
+    });
+    return handle;
+}
+#endif
+
+size_t AssetLoader::processUploads(double budgetMilliseconds) {
+    auto start = std::chrono::steady_clock::now();
+    size_t count = 0;
+    while (true) {
+        Job job;
+        _lock();
+        if (_uploadJobs.empty()) {
+            _unlock();
+            break;
+        }
+        job = std::move(_uploadJobs.front());
+        _uploadJobs.pop_front();
+        _unlock();
+
+        job.run();
+        count++;
+
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() >= budgetMilliseconds) {
+            break;
+        }
+    }
+    return count;
+}
+
+size_t AssetLoader::pendingCount() {
+    _lock();
+    size_t count = _pendingCount;
+    _unlock();
+    return count;
+}
+
+void AssetLoader::_lock() {
+#ifdef DREAMCAST
+    mutex_lock(&_mutex);
+#else
+    _mutex.lock();
+#endif
+}
+
+void AssetLoader::_unlock() {
+#ifdef DREAMCAST
+    mutex_unlock(&_mutex);
+#else
+    _mutex.unlock();
+#endif
+}
+
+void AssetLoader::_workerLoop() {
+    while (true) {
+        Job job;
+        _lock();
+        while (_decodeJobs.empty() && !_isStopping) {
+#ifdef DREAMCAST
+            cond_wait(&_condition, &_mutex);
+#else
+            std::unique_lock<std::mutex> lock(_mutex, std::adopt_lock);
+            _condition.wait(lock);
+            lock.release();
+#endif
+        }
+        if (_isStopping) {
+            _unlock();
+            return;
+        }
+        job = std::move(_decodeJobs.front());
+        _decodeJobs.pop_front();
+        _unlock();
+
+        job.run();
+    }
+}
+
+void AssetLoader::_queueDecode(std::shared_ptr<AssetHandleBase> handle, std::function<void()> decode) {
+    _lock();
+    _pendingCount++;
+    _decodeJobs.push_back({ handle, decode });
+#ifdef DREAMCAST
+    cond_signal(&_condition);
+#else
+    _condition.notify_one();
+#endif
+    _unlock();
+}
+
+void AssetLoader::_queueUpload(std::shared_ptr<AssetHandleBase> handle, std::function<void()> upload) {
+    _lock();
+    _uploadJobs.push_back({ handle, upload });
+    _unlock();
+}
+
+void AssetLoader::_finish(AssetHandleBase& handle, bool success) {
+    if (!success) {
+        ERROR_PRINTLN("AssetLoader - Failed to load %s", handle._path.c_str());
+    }
+    handle._state.store(success ? AssetState::Ready : AssetState::Failed, std::memory_order_release);
+    _lock();
+    _pendingCount--;
+    _unlock();
+}
@@ -0,0 +1,57 @@
+#include "glex/common/font.h"
+
+#include <algorithm>
+
+static void _buildGlyphLookup(texture_font_t* font) {
+    for (size_t i = 0; i < 256; i++) {
+        font->glyph_lookup_latin1[i] = -1;
+    }
+    font->glyph_lookup.clear();
+
+    for (size_t i = 0; i < font->glyphs_count; i++) {
+        wchar_t charcode = font->glyphs[i].charcode;
+        if (charcode >= 0 && charcode < 256) {
+            font->glyph_lookup_latin1[charcode] = (int16_t)i;
+        } else {
+            font->glyph_lookup.push_back({ charcode, i });
+        }
+    }
+    std::sort(font->glyph_lookup.begin(), font->glyph_lookup.end(), [](const glyph_lookup_entry_t& lhs, const glyph_lookup_entry_t& rhs) {
+        return lhs.charcode < rhs.charcode;
+    });
+}
+
+texture_font_t texture_font_create(size_t tex_width, size_t tex_height, size_t tex_depth, const unsigned char* tex_data,
+                                   float size, float height, float linegap, float ascender, float descender,
+                                   size_t glyphs_count, const texture_glyph_t* glyphs, const kerning_t* kerning) {
+    texture_font_t font;
+    font.tex_width = tex_width;
+    font.tex_height = tex_height;
+    font.tex_depth = tex_depth;
+    font.tex_data = tex_data;
+    font.size = size;
+    font.height = height;
+    font.linegap = linegap;
+    font.ascender = ascender;
+    font.descender = descender;
+    font.glyphs_count = glyphs_count;
+    font.glyphs = glyphs;
+    font.kerning = kerning;
+    _buildGlyphLookup(&font);
+    return font;
+}
+
+const texture_glyph_t* texture_font_find_glyph(const texture_font_t* font, wchar_t charcode) {
+    if (charcode >= 0 && charcode < 256) {
+        int16_t index = font->glyph_lookup_latin1[charcode];
+        return index < 0 ? NULL : &font->glyphs[(size_t)index];
+    }
+
+    auto entry = std::lower_bound(font->glyph_lookup.begin(), font->glyph_lookup.end(), charcode, [](const glyph_lookup_entry_t& lhs, wchar_t charcode) {
+        return lhs.charcode < charcode;
+    });
+    if (entry == font->glyph_lookup.end() || entry->charcode != charcode) {
+        return NULL;
+    }
+    return &font->glyphs[entry->index];
+}
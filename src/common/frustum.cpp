@@ -0,0 +1,74 @@
+#include "glex/common/frustum.h"
+
+#include <cmath>
+
+static Frustum _currentFrustum;
+static bool _hasCurrentFrustum = false;
+static bool _isCurrentFrustumActive = false;
+
+static Plane _normalizedPlane(float a, float b, float c, float d) {
+    float length = sqrtf(a * a + b * b + c * c);
+    Plane plane;
+    if (length > 0) {
+        plane.a = a / length;
+        plane.b = b / length;
+        plane.c = c / length;
+        plane.d = d / length;
+    }
+    return plane;
+}
+
+Frustum Frustum::fromMatrix(const float m[16]) {
+    // Gribb/Hartmann: each plane is the last row of the matrix plus or minus one of the others
+    Frustum frustum;
+    frustum.planes[PLANE_LEFT]   = _normalizedPlane(m[3] + m[0], m[7] + m[4], m[11] + m[8],  m[15] + m[12]);
+    frustum.planes[PLANE_RIGHT]  = _normalizedPlane(m[3] - m[0], m[7] - m[4], m[11] - m[8],  m[15] - m[12]);
+    frustum.planes[PLANE_BOTTOM] = _normalizedPlane(m[3] + m[1], m[7] + m[5], m[11] + m[9],  m[15] + m[13]);
+    frustum.planes[PLANE_TOP]    = _normalizedPlane(m[3] - m[1], m[7] - m[5], m[11] - m[9],  m[15] - m[13]);
+    frustum.planes[PLANE_NEAR]   = _normalizedPlane(m[3] + m[2], m[7] + m[6], m[11] + m[10], m[15] + m[14]);
+    frustum.planes[PLANE_FAR]    = _normalizedPlane(m[3] - m[2], m[7] - m[6], m[11] - m[10], m[15] - m[14]);
+    return frustum;
+}
+
+bool Frustum::intersects(const BoundingSphere& sphere) const {
+    for (int i = 0; i < PLANE_COUNT; i++) {
+        if (planes[i].distance(sphere.center) < -sphere.radius) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Frustum::intersects(const BoundingBox& box) const {
+    for (int i = 0; i < PLANE_COUNT; i++) {
+        // Test the corner farthest along the plane normal, if that's outside the whole box is
+        const Plane& plane = planes[i];
+        const float corner[3] = {
+            plane.a >= 0 ? box.max[0] : box.min[0],
+            plane.b >= 0 ? box.max[1] : box.min[1],
+            plane.c >= 0 ? box.max[2] : box.min[2]
+        };
+        if (plane.distance(corner) < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+const Frustum* Frustum::current() {
+    return _isCurrentFrustumActive ? &_currentFrustum : nullptr;
+}
+
+void Frustum::setCurrent(const Frustum& frustum) {
+    _currentFrustum = frustum;
+    _hasCurrentFrustum = true;
+    _isCurrentFrustumActive = true;
+}
+
+void Frustum::clearCurrent() {
+    _isCurrentFrustumActive = false;
+}
+
+void Frustum::restoreCurrent() {
+    _isCurrentFrustumActive = _hasCurrentFrustum;
+}
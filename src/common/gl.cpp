@@ -0,0 +1,189 @@
+#include "glex/common/gl.h"
+
+// Tracked values are UNKNOWN until first set, so the first call of each kind is always issued
+static constexpr int8_t UNKNOWN = -1;
+static constexpr GLenum UNKNOWN_ENUM = 0xFFFFFFFF;
+
+static constexpr GLenum CAPABILITIES[] = { GL_DEPTH_TEST, GL_BLEND, GL_TEXTURE_2D, GL_CULL_FACE, GL_LIGHTING };
+static constexpr int NUM_CAPABILITIES = sizeof(CAPABILITIES) / sizeof(CAPABILITIES[0]);
+static constexpr GLenum CLIENT_ARRAYS[] = { GL_VERTEX_ARRAY, GL_NORMAL_ARRAY, GL_TEXTURE_COORD_ARRAY, GL_COLOR_ARRAY };
+static constexpr int NUM_CLIENT_ARRAYS = sizeof(CLIENT_ARRAYS) / sizeof(CLIENT_ARRAYS[0]);
+
+static int8_t _capabilities[NUM_CAPABILITIES] = { UNKNOWN, UNKNOWN, UNKNOWN, UNKNOWN, UNKNOWN };
+static int8_t _clientArrays[NUM_CLIENT_ARRAYS] = { UNKNOWN, UNKNOWN, UNKNOWN, UNKNOWN };
+static GLenum _depthFunc = UNKNOWN_ENUM;
+static GLenum _blendSourceFactor = UNKNOWN_ENUM;
+static GLenum _blendDestinationFactor = UNKNOWN_ENUM;
+static GLenum _cullFace = UNKNOWN_ENUM;
+static GLenum _texEnvMode = UNKNOWN_ENUM;
+static GLuint _boundTexture = 0;
+static bool _isBoundTextureKnown = false;
+
+static uint32_t _issuedCalls = 0;
+static uint32_t _skippedCalls = 0;
+static uint32_t _lastFrameIssuedCalls = 0;
+static uint32_t _lastFrameSkippedCalls = 0;
+
+static inline int _capabilityIndex(GLenum capability) {
+    for (int i = 0; i < NUM_CAPABILITIES; i++) {
+        if (CAPABILITIES[i] == capability) return i;
+    }
+    return -1;
+}
+
+static inline int _clientArrayIndex(GLenum array) {
+    for (int i = 0; i < NUM_CLIENT_ARRAYS; i++) {
+        if (CLIENT_ARRAYS[i] == array) return i;
+    }
+    return -1;
+}
+
+// Returns true if the call needs to be issued and updates the counters
+static inline bool _shouldIssue(bool isChange) {
+    if (isChange) {
+        _issuedCalls++;
+    } else {
+        _skippedCalls++;
+    }
+    return isChange;
+}
+
+void GLStateCache::enable(GLenum capability) {
+    int index = _capabilityIndex(capability);
+    if (index < 0) {
+        _issuedCalls++;
+        glEnable(capability);
+    } else if (_shouldIssue(_capabilities[index] != 1)) {
+        _capabilities[index] = 1;
+        glEnable(capability);
+    }
+}
+
+void GLStateCache::disable(GLenum capability) {
+    int index = _capabilityIndex(capability);
+    if (index < 0) {
+        _issuedCalls++;
+        glDisable(capability);
+    } else if (_shouldIssue(_capabilities[index] != 0)) {
+        _capabilities[index] = 0;
+        glDisable(capability);
+    }
+}
+
+bool GLStateCache::isEnabled(GLenum capability) {
+    int index = _capabilityIndex(capability);
+    if (index < 0 || _capabilities[index] == UNKNOWN) {
+        return glIsEnabled(capability) == GL_TRUE;
+    }
+    return _capabilities[index] == 1;
+}
+
+void GLStateCache::depthFunc(GLenum func) {
+    if (_shouldIssue(_depthFunc != func)) {
+        _depthFunc = func;
+        glDepthFunc(func);
+    }
+}
+
+void GLStateCache::blendFunc(GLenum sourceFactor, GLenum destinationFactor) {
+    if (_shouldIssue(_blendSourceFactor != sourceFactor || _blendDestinationFactor != destinationFactor)) {
+        _blendSourceFactor = sourceFactor;
+        _blendDestinationFactor = destinationFactor;
+        glBlendFunc(sourceFactor, destinationFactor);
+    }
+}
+
+void GLStateCache::cullFace(GLenum mode) {
+    if (_shouldIssue(_cullFace != mode)) {
+        _cullFace = mode;
+        glCullFace(mode);
+    }
+}
+
+void GLStateCache::texEnvMode(GLenum mode) {
+    if (_shouldIssue(_texEnvMode != mode)) {
+        _texEnvMode = mode;
+        glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, (GLfloat)mode);
+    }
+}
+
+void GLStateCache::bindTexture(GLuint texture) {
+    if (_shouldIssue(!_isBoundTextureKnown || _boundTexture != texture)) {
+        _boundTexture = texture;
+        _isBoundTextureKnown = true;
+        glBindTexture(GL_TEXTURE_2D, texture);
+    }
+}
+
+void GLStateCache::deleteTextures(GLsizei count, const GLuint* textures) {
+    _issuedCalls++;
+    glDeleteTextures(count, textures);
+
+    // Deleting the bound texture reverts the binding to 0
+    for (GLsizei i = 0; i < count; i++) {
+        if (_isBoundTextureKnown && textures[i] == _boundTexture) {
+            _boundTexture = 0;
+        }
+    }
+}
+
+void GLStateCache::enableClientState(GLenum array) {
+    int index = _clientArrayIndex(array);
+    if (index < 0) {
+        _issuedCalls++;
+        glEnableClientState(array);
+    } else if (_shouldIssue(_clientArrays[index] != 1)) {
+        _clientArrays[index] = 1;
+        glEnableClientState(array);
+    }
+}
+
+void GLStateCache::disableClientState(GLenum array) {
+    int index = _clientArrayIndex(array);
+    if (index < 0) {
+        _issuedCalls++;
+        glDisableClientState(array);
+    } else if (_shouldIssue(_clientArrays[index] != 0)) {
+        _clientArrays[index] = 0;
+        glDisableClientState(array);
+    }
+}
+
+void GLStateCache::invalidate() {
+    for (int i = 0; i < NUM_CAPABILITIES; i++) {
+        _capabilities[i] = UNKNOWN;
+    }
+    for (int i = 0; i < NUM_CLIENT_ARRAYS; i++) {
+        _clientArrays[i] = UNKNOWN;
+    }
+    _depthFunc = UNKNOWN_ENUM;
+    _blendSourceFactor = UNKNOWN_ENUM;
+    _blendDestinationFactor = UNKNOWN_ENUM;
+    _cullFace = UNKNOWN_ENUM;
+    _texEnvMode = UNKNOWN_ENUM;
+    _boundTexture = 0;
+    _isBoundTextureKnown = false;
+}
+
+uint32_t GLStateCache::issuedCalls() {
+    return _issuedCalls;
+}
+
+uint32_t GLStateCache::skippedCalls() {
+    return _skippedCalls;
+}
+
+uint32_t GLStateCache::lastFrameIssuedCalls() {
+    return _lastFrameIssuedCalls;
+}
+
+uint32_t GLStateCache::lastFrameSkippedCalls() {
+    return _lastFrameSkippedCalls;
+}
+
+void GLStateCache::endFrame() {
+    _lastFrameIssuedCalls = _issuedCalls;
+    _lastFrameSkippedCalls = _skippedCalls;
+    _issuedCalls = 0;
+    _skippedCalls = 0;
+}
@@ -44,9 +44,10 @@
 
 #include "glex/fonts/arial_16pt.h"
 
-texture_font_t arial_16pt = {
- 128, 128, 1, 
- {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// The font data is constexpr so it lives in read-only memory and costs nothing until the font is used
+
+static constexpr unsigned char tex_data[128 * 128 * 1] = {
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -557,104 +558,209 @@ texture_font_t arial_16pt = {
   0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 
- 16.000000f, 18.400000f, 0.510000f, 14.490000f, -3.400000f, 96, 
- {
-  {L'\0', 0, 0, 0, 0, 0.000000f, 0.000000f, 0.023438f, 0.023438f, 0.031250f, 0.031250f, 0, { } },
-  {L' ', 0, 0, 0, 0, 4.453125f, 0.000000f, 0.046875f, 0.007812f, 0.046875f, 0.007812f, 5, { {L'A', -0.882812f}, {L'L', -0.593750f}, {L'P', -0.289062f}, {L'T', -0.289062f}, {L'Y', -0.289062f}} },
-  {L'!', 3, 12, 1, 12, 4.453125f, 0.000000f, 0.054688f, 0.007812f, 0.078125f, 0.101562f, 0, { } },
-  {L'"', 5, 4, 0, 12, 5.687500f, 0.000000f, 0.085938f, 0.007812f, 0.125000f, 0.039062f, 0, { } },
-  {L'#', 9, 12, 0, 12, 8.906250f, 0.000000f, 0.132812f, 0.007812f, 0.203125f, 0.101562f, 0, { } },
-  {L'$', 9, 16, 0, 14, 8.906250f, 0.000000f, 0.210938f, 0.007812f, 0.281250f, 0.132812f, 0, { } },
-  {L'%', 14, 12, 0, 12, 14.234375f, 0.000000f, 0.289062f, 0.007812f, 0.398438f, 0.101562f, 0, { } },
-  {L'&', 11, 13, 0, 12, 10.671875f, 0.000000f, 0.406250f, 0.007812f, 0.492188f, 0.109375f, 0, { } },
-  {L'\'', 3, 4, 0, 12, 3.062500f, 0.000000f, 0.500000f, 0.007812f, 0.523438f, 0.039062f, 0, { } },
-  {L'(', 5, 15, 0, 12, 5.328125f, 0.000000f, 0.531250f, 0.007812f, 0.570312f, 0.125000f, 0, { } },
-  {L')', 5, 15, 0, 12, 5.328125f, 0.000000f, 0.578125f, 0.007812f, 0.617188f, 0.125000f, 0, { } },
-  {L'*', 6, 6, 0, 12, 6.234375f, 0.000000f, 0.625000f, 0.007812f, 0.671875f, 0.054688f, 0, { } },
-  {L'+', 9, 8, 0, 10, 9.343750f, 0.000000f, 0.679688f, 0.007812f, 0.750000f, 0.070312f, 0, { } },
-  {L',', 3, 5, 1, 2, 4.453125f, 0.000000f, 0.757812f, 0.007812f, 0.781250f, 0.046875f, 10, { {L'F', -1.773438f}, {L'P', -2.062500f}, {L'T', -1.773438f}, {L'V', -1.468750f}, {L'W', -0.882812f}, {L'Y', -2.062500f}, {L'r', -0.882812f}, {L'v', -1.187500f}, {L'w', -0.882812f}, {L'y', -1.187500f}} },
-  {L'-', 5, 3, 0, 6, 5.328125f, 0.000000f, 0.789062f, 0.007812f, 0.828125f, 0.031250f, 4, { {L'T', -0.882812f}, {L'V', -0.882812f}, {L'W', -0.289062f}, {L'Y', -1.468750f}} },
-  {L'.', 3, 2, 1, 2, 4.453125f, 0.000000f, 0.835938f, 0.007812f, 0.859375f, 0.023438f, 10, { {L'F', -1.773438f}, {L'P', -2.062500f}, {L'T', -1.773438f}, {L'V', -1.468750f}, {L'W', -0.882812f}, {L'Y', -2.062500f}, {L'r', -0.882812f}, {L'v', -1.187500f}, {L'w', -0.882812f}, {L'y', -1.187500f}} },
-  {L'/', 5, 12, 0, 12, 4.453125f, 0.000000f, 0.867188f, 0.007812f, 0.906250f, 0.101562f, 0, { } },
-  {L'0', 9, 12, 0, 12, 8.906250f, 0.000000f, 0.914062f, 0.007812f, 0.984375f, 0.101562f, 0, { } },
-  {L'1', 5, 12, 1, 12, 8.906250f, 0.000000f, 0.789062f, 0.039062f, 0.828125f, 0.132812f, 1, { {L'1', -1.187500f}} },
-  {L'2', 9, 12, 0, 12, 8.906250f, 0.000000f, 0.625000f, 0.078125f, 0.695312f, 0.171875f, 0, { } },
-  {L'3', 9, 12, 0, 12, 8.906250f, 0.000000f, 0.703125f, 0.078125f, 0.773438f, 0.171875f, 0, { } },
-  {L'4', 9, 12, 0, 12, 8.906250f, 0.000000f, 0.046875f, 0.109375f, 0.117188f, 0.203125f, 0, { } },
-  {L'5', 9, 12, 0, 12, 8.906250f, 0.000000f, 0.125000f, 0.109375f, 0.195312f, 0.203125f, 0, { } },
-  {L'6', 9, 12, 0, 12, 8.906250f, 0.000000f, 0.835938f, 0.109375f, 0.906250f, 0.203125f, 0, { } },
-  {L'7', 9, 12, 0, 12, 8.906250f, 0.000000f, 0.914062f, 0.109375f, 0.984375f, 0.203125f, 0, { } },
-  {L'8', 9, 12, 0, 12, 8.906250f, 0.000000f, 0.289062f, 0.109375f, 0.359375f, 0.203125f, 0, { } },
-  {L'9', 9, 12, 0, 12, 8.906250f, 0.000000f, 0.367188f, 0.117188f, 0.437500f, 0.210938f, 0, { } },
-  {L':', 3, 9, 1, 9, 4.453125f, 0.000000f, 0.500000f, 0.046875f, 0.523438f, 0.117188f, 4, { {L'T', -1.773438f}, {L'V', -0.593750f}, {L'W', -0.289062f}, {L'Y', -0.882812f}} },
-  {L';', 3, 12, 1, 9, 4.453125f, 0.000000f, 0.007812f, 0.046875f, 0.031250f, 0.140625f, 4, { {L'T', -1.773438f}, {L'V', -0.593750f}, {L'W', -0.289062f}, {L'Y', -1.039062f}} },
-  {L'<', 9, 10, 0, 11, 9.343750f, 0.000000f, 0.445312f, 0.125000f, 0.515625f, 0.203125f, 0, { } },
-  {L'=', 9, 6, 0, 9, 9.343750f, 0.000000f, 0.523438f, 0.132812f, 0.593750f, 0.179688f, 0, { } },
-  {L'>', 9, 10, 0, 11, 9.343750f, 0.000000f, 0.203125f, 0.140625f, 0.273438f, 0.218750f, 0, { } },
-  {L'?', 9, 12, 0, 12, 8.906250f, 0.000000f, 0.601562f, 0.179688f, 0.671875f, 0.273438f, 0, { } },
-  {L'@', 16, 15, 0, 12, 16.250000f, 0.000000f, 0.679688f, 0.179688f, 0.804688f, 0.296875f, 0, { } },
-  {L'A', 12, 12, -1, 12, 10.671875f, 0.000000f, 0.039062f, 0.210938f, 0.132812f, 0.304688f, 7, { {L' ', -0.882812f}, {L'F', -0.882812f}, {L'P', -1.187500f}, {L'T', -1.187500f}, {L'V', -1.187500f}, {L'W', -0.593750f}, {L'Y', -1.187500f}} },
-  {L'B', 9, 12, 1, 12, 10.671875f, 0.000000f, 0.523438f, 0.187500f, 0.593750f, 0.281250f, 0, { } },
-  {L'C', 11, 12, 0, 12, 11.562500f, 0.000000f, 0.812500f, 0.210938f, 0.898438f, 0.304688f, 0, { } },
-  {L'D', 10, 12, 1, 12, 11.562500f, 0.000000f, 0.281250f, 0.210938f, 0.359375f, 0.304688f, 0, { } },
-  {L'E', 9, 12, 1, 12, 10.671875f, 0.000000f, 0.445312f, 0.210938f, 0.515625f, 0.304688f, 0, { } },
-  {L'F', 9, 12, 1, 12, 9.781250f, 0.000000f, 0.906250f, 0.210938f, 0.976562f, 0.304688f, 0, { } },
-  {L'G', 12, 12, 0, 12, 12.453125f, 0.000000f, 0.140625f, 0.226562f, 0.234375f, 0.320312f, 0, { } },
-  {L'H', 10, 12, 1, 12, 11.562500f, 0.000000f, 0.523438f, 0.289062f, 0.601562f, 0.382812f, 0, { } },
-  {L'I', 2, 12, 1, 12, 4.453125f, 0.000000f, 0.007812f, 0.148438f, 0.023438f, 0.242188f, 0, { } },
-  {L'J', 7, 12, 0, 12, 8.000000f, 0.000000f, 0.367188f, 0.218750f, 0.421875f, 0.312500f, 0, { } },
-  {L'K', 10, 12, 1, 12, 10.671875f, 0.000000f, 0.609375f, 0.304688f, 0.687500f, 0.398438f, 0, { } },
-  {L'L', 8, 12, 1, 12, 8.906250f, 0.000000f, 0.695312f, 0.304688f, 0.757812f, 0.398438f, 0, { } },
-  {L'M', 12, 12, 1, 12, 13.328125f, 0.000000f, 0.031250f, 0.312500f, 0.125000f, 0.406250f, 0, { } },
-  {L'N', 10, 12, 1, 12, 11.562500f, 0.000000f, 0.429688f, 0.312500f, 0.507812f, 0.406250f, 0, { } },
-  {L'O', 12, 12, 0, 12, 12.453125f, 0.000000f, 0.242188f, 0.312500f, 0.335938f, 0.406250f, 1, { {L'T', -0.289062f}} },
-  {L'P', 9, 12, 1, 12, 10.671875f, 0.000000f, 0.765625f, 0.312500f, 0.835938f, 0.406250f, 0, { } },
-  {L'Q', 12, 13, 0, 12, 12.453125f, 0.000000f, 0.843750f, 0.312500f, 0.937500f, 0.414062f, 0, { } },
-  {L'R', 11, 12, 1, 12, 11.562500f, 0.000000f, 0.132812f, 0.328125f, 0.218750f, 0.421875f, 0, { } },
-  {L'S', 10, 12, 0, 12, 10.671875f, 0.000000f, 0.343750f, 0.320312f, 0.421875f, 0.414062f, 0, { } },
-  {L'T', 10, 12, 0, 12, 9.781250f, 0.000000f, 0.515625f, 0.390625f, 0.593750f, 0.484375f, 4, { {L' ', -0.289062f}, {L'A', -1.187500f}, {L'L', -1.187500f}, {L'R', -0.289062f}} },
-  {L'U', 10, 12, 1, 12, 11.562500f, 0.000000f, 0.601562f, 0.406250f, 0.679688f, 0.500000f, 0, { } },
-  {L'V', 11, 12, 0, 12, 10.671875f, 0.000000f, 0.226562f, 0.414062f, 0.312500f, 0.507812f, 3, { {L'A', -1.187500f}, {L'L', -1.187500f}, {L'R', -0.289062f}} },
-  {L'W', 15, 12, 0, 12, 15.109375f, 0.000000f, 0.007812f, 0.414062f, 0.125000f, 0.507812f, 3, { {L'A', -0.593750f}, {L'L', -1.187500f}, {L'R', -0.289062f}} },
-  {L'X', 11, 12, 0, 12, 10.671875f, 0.000000f, 0.687500f, 0.414062f, 0.773438f, 0.507812f, 0, { } },
-  {L'Y', 11, 12, 0, 12, 10.671875f, 0.000000f, 0.320312f, 0.421875f, 0.406250f, 0.515625f, 4, { {L' ', -0.289062f}, {L'A', -1.187500f}, {L'L', -1.187500f}, {L'R', -0.289062f}} },
-  {L'Z', 10, 12, 0, 12, 9.781250f, 0.000000f, 0.429688f, 0.414062f, 0.507812f, 0.507812f, 0, { } },
-  {L'[', 4, 15, 1, 12, 4.453125f, 0.000000f, 0.945312f, 0.312500f, 0.976562f, 0.429688f, 0, { } },
-  {L'\\', 5, 12, 0, 12, 4.453125f, 0.000000f, 0.781250f, 0.414062f, 0.820312f, 0.507812f, 0, { } },
-  {L']', 4, 15, 0, 12, 4.453125f, 0.000000f, 0.828125f, 0.421875f, 0.859375f, 0.539062f, 0, { } },
-  {L'^', 8, 7, 0, 13, 7.515625f, 0.000000f, 0.867188f, 0.421875f, 0.929688f, 0.476562f, 0, { } },
-  {L'_', 11, 3, -1, -1, 8.906250f, 0.000000f, 0.132812f, 0.429688f, 0.218750f, 0.453125f, 0, { } },
-  {L'`', 4, 3, 0, 13, 5.328125f, 0.000000f, 0.937500f, 0.437500f, 0.968750f, 0.460938f, 0, { } },
-  {L'a', 9, 9, 0, 9, 8.906250f, 0.000000f, 0.132812f, 0.460938f, 0.203125f, 0.531250f, 4, { {L'T', -1.773438f}, {L'V', -1.187500f}, {L'W', -0.593750f}, {L'Y', -1.187500f}} },
-  {L'b', 8, 12, 1, 12, 8.906250f, 0.000000f, 0.867188f, 0.484375f, 0.929688f, 0.578125f, 0, { } },
-  {L'c', 8, 9, 0, 9, 8.000000f, 0.000000f, 0.515625f, 0.492188f, 0.578125f, 0.562500f, 1, { {L'T', -1.773438f}} },
-  {L'd', 8, 12, 0, 12, 8.906250f, 0.000000f, 0.585938f, 0.507812f, 0.648438f, 0.601562f, 0, { } },
-  {L'e', 9, 9, 0, 9, 8.906250f, 0.000000f, 0.210938f, 0.515625f, 0.281250f, 0.585938f, 4, { {L'T', -1.773438f}, {L'V', -0.882812f}, {L'W', -0.289062f}, {L'Y', -1.468750f}} },
-  {L'f', 5, 12, 0, 12, 4.453125f, 0.000000f, 0.937500f, 0.468750f, 0.976562f, 0.562500f, 1, { {L'f', -0.289062f}} },
-  {L'g', 8, 12, 0, 9, 8.906250f, 0.000000f, 0.414062f, 0.515625f, 0.476562f, 0.609375f, 0, { } },
-  {L'h', 7, 12, 1, 12, 8.906250f, 0.000000f, 0.656250f, 0.515625f, 0.710938f, 0.609375f, 0, { } },
-  {L'i', 2, 12, 1, 12, 3.562500f, 0.000000f, 0.289062f, 0.515625f, 0.304688f, 0.609375f, 3, { {L'T', -0.593750f}, {L'V', -0.289062f}, {L'Y', -0.593750f}} },
-  {L'j', 4, 15, -1, 12, 3.562500f, 0.000000f, 0.718750f, 0.515625f, 0.750000f, 0.632812f, 0, { } },
-  {L'k', 7, 12, 1, 12, 8.000000f, 0.000000f, 0.757812f, 0.515625f, 0.812500f, 0.609375f, 0, { } },
-  {L'l', 2, 12, 1, 12, 3.562500f, 0.000000f, 0.484375f, 0.515625f, 0.500000f, 0.609375f, 0, { } },
-  {L'm', 12, 9, 1, 9, 13.328125f, 0.000000f, 0.007812f, 0.515625f, 0.101562f, 0.585938f, 0, { } },
-  {L'n', 7, 9, 1, 9, 8.906250f, 0.000000f, 0.312500f, 0.523438f, 0.367188f, 0.593750f, 0, { } },
-  {L'o', 9, 9, 0, 9, 8.906250f, 0.000000f, 0.109375f, 0.539062f, 0.179688f, 0.609375f, 4, { {L'T', -1.773438f}, {L'V', -0.882812f}, {L'W', -0.289062f}, {L'Y', -1.468750f}} },
-  {L'p', 8, 12, 1, 9, 8.906250f, 0.000000f, 0.507812f, 0.570312f, 0.570312f, 0.664062f, 1, { {L'Y', -1.187500f}} },
-  {L'q', 8, 12, 0, 9, 8.906250f, 0.000000f, 0.820312f, 0.585938f, 0.882812f, 0.679688f, 1, { {L'Y', -1.468750f}} },
-  {L'r', 5, 9, 1, 9, 5.328125f, 0.000000f, 0.937500f, 0.570312f, 0.976562f, 0.640625f, 3, { {L'T', -0.593750f}, {L'V', -0.593750f}, {L'W', -0.289062f}} },
-  {L's', 8, 9, 0, 9, 8.000000f, 0.000000f, 0.187500f, 0.593750f, 0.250000f, 0.664062f, 1, { {L'T', -1.773438f}} },
-  {L't', 5, 13, 0, 13, 4.453125f, 0.000000f, 0.890625f, 0.585938f, 0.929688f, 0.687500f, 0, { } },
-  {L'u', 7, 9, 1, 9, 8.906250f, 0.000000f, 0.007812f, 0.593750f, 0.062500f, 0.664062f, 4, { {L'T', -0.593750f}, {L'V', -0.593750f}, {L'W', -0.289062f}, {L'Y', -0.882812f}} },
-  {L'v', 8, 9, 0, 9, 8.000000f, 0.000000f, 0.312500f, 0.601562f, 0.375000f, 0.671875f, 2, { {L'A', -0.289062f}, {L'Y', -0.882812f}} },
-  {L'w', 12, 9, 0, 9, 11.562500f, 0.000000f, 0.578125f, 0.617188f, 0.671875f, 0.687500f, 2, { {L'A', -0.289062f}, {L'T', -0.882812f}} },
-  {L'x', 8, 9, 0, 9, 8.000000f, 0.000000f, 0.382812f, 0.617188f, 0.445312f, 0.687500f, 0, { } },
-  {L'y', 8, 12, 0, 9, 8.000000f, 0.000000f, 0.070312f, 0.617188f, 0.132812f, 0.710938f, 5, { {L'A', -0.289062f}, {L'L', -0.593750f}, {L'T', -0.882812f}, {L'V', -0.593750f}, {L'W', -0.140625f}} },
-  {L'z', 8, 9, 0, 9, 8.000000f, 0.000000f, 0.679688f, 0.640625f, 0.742188f, 0.710938f, 0, { } },
-  {L'{', 5, 15, 0, 12, 5.343750f, 0.000000f, 0.257812f, 0.617188f, 0.296875f, 0.734375f, 0, { } },
-  {L'|', 2, 15, 1, 12, 4.156250f, 0.000000f, 0.140625f, 0.617188f, 0.156250f, 0.734375f, 0, { } },
-  {L'}', 5, 15, 0, 12, 5.343750f, 0.000000f, 0.453125f, 0.617188f, 0.492188f, 0.734375f, 0, { } },
-  {L'~', 9, 4, 0, 8, 9.343750f, 0.000000f, 0.500000f, 0.671875f, 0.570312f, 0.703125f, 0, { } },
- }
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+static constexpr kerning_t kerning[96] = {
+  {L'A', -0.882812f},
+  {L'L', -0.593750f},
+  {L'P', -0.289062f},
+  {L'T', -0.289062f},
+  {L'Y', -0.289062f},
+  {L'F', -1.773438f},
+  {L'P', -2.062500f},
+  {L'T', -1.773438f},
+  {L'V', -1.468750f},
+  {L'W', -0.882812f},
+  {L'Y', -2.062500f},
+  {L'r', -0.882812f},
+  {L'v', -1.187500f},
+  {L'w', -0.882812f},
+  {L'y', -1.187500f},
+  {L'T', -0.882812f},
+  {L'V', -0.882812f},
+  {L'W', -0.289062f},
+  {L'Y', -1.468750f},
+  {L'F', -1.773438f},
+  {L'P', -2.062500f},
+  {L'T', -1.773438f},
+  {L'V', -1.468750f},
+  {L'W', -0.882812f},
+  {L'Y', -2.062500f},
+  {L'r', -0.882812f},
+  {L'v', -1.187500f},
+  {L'w', -0.882812f},
+  {L'y', -1.187500f},
+  {L'1', -1.187500f},
+  {L'T', -1.773438f},
+  {L'V', -0.593750f},
+  {L'W', -0.289062f},
+  {L'Y', -0.882812f},
+  {L'T', -1.773438f},
+  {L'V', -0.593750f},
+  {L'W', -0.289062f},
+  {L'Y', -1.039062f},
+  {L' ', -0.882812f},
+  {L'F', -0.882812f},
+  {L'P', -1.187500f},
+  {L'T', -1.187500f},
+  {L'V', -1.187500f},
+  {L'W', -0.593750f},
+  {L'Y', -1.187500f},
+  {L'T', -0.289062f},
+  {L' ', -0.289062f},
+  {L'A', -1.187500f},
+  {L'L', -1.187500f},
+  {L'R', -0.289062f},
+  {L'A', -1.187500f},
+  {L'L', -1.187500f},
+  {L'R', -0.289062f},
+  {L'A', -0.593750f},
+  {L'L', -1.187500f},
+  {L'R', -0.289062f},
+  {L' ', -0.289062f},
+  {L'A', -1.187500f},
+  {L'L', -1.187500f},
+  {L'R', -0.289062f},
+  {L'T', -1.773438f},
+  {L'V', -1.187500f},
+  {L'W', -0.593750f},
+  {L'Y', -1.187500f},
+  {L'T', -1.773438f},
+  {L'T', -1.773438f},
+  {L'V', -0.882812f},
+  {L'W', -0.289062f},
+  {L'Y', -1.468750f},
+  {L'f', -0.289062f},
+  {L'T', -0.593750f},
+  {L'V', -0.289062f},
+  {L'Y', -0.593750f},
+  {L'T', -1.773438f},
+  {L'V', -0.882812f},
+  {L'W', -0.289062f},
+  {L'Y', -1.468750f},
+  {L'Y', -1.187500f},
+  {L'Y', -1.468750f},
+  {L'T', -0.593750f},
+  {L'V', -0.593750f},
+  {L'W', -0.289062f},
+  {L'T', -1.773438f},
+  {L'T', -0.593750f},
+  {L'V', -0.593750f},
+  {L'W', -0.289062f},
+  {L'Y', -0.882812f},
+  {L'A', -0.289062f},
+  {L'Y', -0.882812f},
+  {L'A', -0.289062f},
+  {L'T', -0.882812f},
+  {L'A', -0.289062f},
+  {L'L', -0.593750f},
+  {L'T', -0.882812f},
+  {L'V', -0.593750f},
+  {L'W', -0.140625f},
 };
+
+static constexpr texture_glyph_t glyphs[96] = {
+  {L'\0', 0, 0, 0, 0, 0.000000f, 0.000000f, 0.023438f, 0.023438f, 0.031250f, 0.031250f, 0, 0},
+  {L' ', 0, 0, 0, 0, 4.453125f, 0.000000f, 0.046875f, 0.007812f, 0.046875f, 0.007812f, 0, 5},
+  {L'!', 3, 12, 1, 12, 4.453125f, 0.000000f, 0.054688f, 0.007812f, 0.078125f, 0.101562f, 5, 0},
+  {L'"', 5, 4, 0, 12, 5.687500f, 0.000000f, 0.085938f, 0.007812f, 0.125000f, 0.039062f, 5, 0},
+  {L'#', 9, 12, 0, 12, 8.906250f, 0.000000f, 0.132812f, 0.007812f, 0.203125f, 0.101562f, 5, 0},
+  {L'$', 9, 16, 0, 14, 8.906250f, 0.000000f, 0.210938f, 0.007812f, 0.281250f, 0.132812f, 5, 0},
+  {L'%', 14, 12, 0, 12, 14.234375f, 0.000000f, 0.289062f, 0.007812f, 0.398438f, 0.101562f, 5, 0},
+  {L'&', 11, 13, 0, 12, 10.671875f, 0.000000f, 0.406250f, 0.007812f, 0.492188f, 0.109375f, 5, 0},
+  {L'\'', 3, 4, 0, 12, 3.062500f, 0.000000f, 0.500000f, 0.007812f, 0.523438f, 0.039062f, 5, 0},
+  {L'(', 5, 15, 0, 12, 5.328125f, 0.000000f, 0.531250f, 0.007812f, 0.570312f, 0.125000f, 5, 0},
+  {L')', 5, 15, 0, 12, 5.328125f, 0.000000f, 0.578125f, 0.007812f, 0.617188f, 0.125000f, 5, 0},
+  {L'*', 6, 6, 0, 12, 6.234375f, 0.000000f, 0.625000f, 0.007812f, 0.671875f, 0.054688f, 5, 0},
+  {L'+', 9, 8, 0, 10, 9.343750f, 0.000000f, 0.679688f, 0.007812f, 0.750000f, 0.070312f, 5, 0},
+  {L',', 3, 5, 1, 2, 4.453125f, 0.000000f, 0.757812f, 0.007812f, 0.781250f, 0.046875f, 5, 10},
+  {L'-', 5, 3, 0, 6, 5.328125f, 0.000000f, 0.789062f, 0.007812f, 0.828125f, 0.031250f, 15, 4},
+  {L'.', 3, 2, 1, 2, 4.453125f, 0.000000f, 0.835938f, 0.007812f, 0.859375f, 0.023438f, 19, 10},
+  {L'/', 5, 12, 0, 12, 4.453125f, 0.000000f, 0.867188f, 0.007812f, 0.906250f, 0.101562f, 29, 0},
+  {L'0', 9, 12, 0, 12, 8.906250f, 0.000000f, 0.914062f, 0.007812f, 0.984375f, 0.101562f, 29, 0},
+  {L'1', 5, 12, 1, 12, 8.906250f, 0.000000f, 0.789062f, 0.039062f, 0.828125f, 0.132812f, 29, 1},
+  {L'2', 9, 12, 0, 12, 8.906250f, 0.000000f, 0.625000f, 0.078125f, 0.695312f, 0.171875f, 30, 0},
+  {L'3', 9, 12, 0, 12, 8.906250f, 0.000000f, 0.703125f, 0.078125f, 0.773438f, 0.171875f, 30, 0},
+  {L'4', 9, 12, 0, 12, 8.906250f, 0.000000f, 0.046875f, 0.109375f, 0.117188f, 0.203125f, 30, 0},
+  {L'5', 9, 12, 0, 12, 8.906250f, 0.000000f, 0.125000f, 0.109375f, 0.195312f, 0.203125f, 30, 0},
+  {L'6', 9, 12, 0, 12, 8.906250f, 0.000000f, 0.835938f, 0.109375f, 0.906250f, 0.203125f, 30, 0},
+  {L'7', 9, 12, 0, 12, 8.906250f, 0.000000f, 0.914062f, 0.109375f, 0.984375f, 0.203125f, 30, 0},
+  {L'8', 9, 12, 0, 12, 8.906250f, 0.000000f, 0.289062f, 0.109375f, 0.359375f, 0.203125f, 30, 0},
+  {L'9', 9, 12, 0, 12, 8.906250f, 0.000000f, 0.367188f, 0.117188f, 0.437500f, 0.210938f, 30, 0},
+  {L':', 3, 9, 1, 9, 4.453125f, 0.000000f, 0.500000f, 0.046875f, 0.523438f, 0.117188f, 30, 4},
+  {L';', 3, 12, 1, 9, 4.453125f, 0.000000f, 0.007812f, 0.046875f, 0.031250f, 0.140625f, 34, 4},
+  {L'<', 9, 10, 0, 11, 9.343750f, 0.000000f, 0.445312f, 0.125000f, 0.515625f, 0.203125f, 38, 0},
+  {L'=', 9, 6, 0, 9, 9.343750f, 0.000000f, 0.523438f, 0.132812f, 0.593750f, 0.179688f, 38, 0},
+  {L'>', 9, 10, 0, 11, 9.343750f, 0.000000f, 0.203125f, 0.140625f, 0.273438f, 0.218750f, 38, 0},
+  {L'?', 9, 12, 0, 12, 8.906250f, 0.000000f, 0.601562f, 0.179688f, 0.671875f, 0.273438f, 38, 0},
+  {L'@', 16, 15, 0, 12, 16.250000f, 0.000000f, 0.679688f, 0.179688f, 0.804688f, 0.296875f, 38, 0},
+  {L'A', 12, 12, -1, 12, 10.671875f, 0.000000f, 0.039062f, 0.210938f, 0.132812f, 0.304688f, 38, 7},
+  {L'B', 9, 12, 1, 12, 10.671875f, 0.000000f, 0.523438f, 0.187500f, 0.593750f, 0.281250f, 45, 0},
+  {L'C', 11, 12, 0, 12, 11.562500f, 0.000000f, 0.812500f, 0.210938f, 0.898438f, 0.304688f, 45, 0},
+  {L'D', 10, 12, 1, 12, 11.562500f, 0.000000f, 0.281250f, 0.210938f, 0.359375f, 0.304688f, 45, 0},
+  {L'E', 9, 12, 1, 12, 10.671875f, 0.000000f, 0.445312f, 0.210938f, 0.515625f, 0.304688f, 45, 0},
+  {L'F', 9, 12, 1, 12, 9.781250f, 0.000000f, 0.906250f, 0.210938f, 0.976562f, 0.304688f, 45, 0},
+  {L'G', 12, 12, 0, 12, 12.453125f, 0.000000f, 0.140625f, 0.226562f, 0.234375f, 0.320312f, 45, 0},
+  {L'H', 10, 12, 1, 12, 11.562500f, 0.000000f, 0.523438f, 0.289062f, 0.601562f, 0.382812f, 45, 0},
+  {L'I', 2, 12, 1, 12, 4.453125f, 0.000000f, 0.007812f, 0.148438f, 0.023438f, 0.242188f, 45, 0},
+  {L'J', 7, 12, 0, 12, 8.000000f, 0.000000f, 0.367188f, 0.218750f, 0.421875f, 0.312500f, 45, 0},
+  {L'K', 10, 12, 1, 12, 10.671875f, 0.000000f, 0.609375f, 0.304688f, 0.687500f, 0.398438f, 45, 0},
+  {L'L', 8, 12, 1, 12, 8.906250f, 0.000000f, 0.695312f, 0.304688f, 0.757812f, 0.398438f, 45, 0},
+  {L'M', 12, 12, 1, 12, 13.328125f, 0.000000f, 0.031250f, 0.312500f, 0.125000f, 0.406250f, 45, 0},
+  {L'N', 10, 12, 1, 12, 11.562500f, 0.000000f, 0.429688f, 0.312500f, 0.507812f, 0.406250f, 45, 0},
+  {L'O', 12, 12, 0, 12, 12.453125f, 0.000000f, 0.242188f, 0.312500f, 0.335938f, 0.406250f, 45, 1},
+  {L'P', 9, 12, 1, 12, 10.671875f, 0.000000f, 0.765625f, 0.312500f, 0.835938f, 0.406250f, 46, 0},
+  {L'Q', 12, 13, 0, 12, 12.453125f, 0.000000f, 0.843750f, 0.312500f, 0.937500f, 0.414062f, 46, 0},
+  {L'R', 11, 12, 1, 12, 11.562500f, 0.000000f, 0.132812f, 0.328125f, 0.218750f, 0.421875f, 46, 0},
+  {L'S', 10, 12, 0, 12, 10.671875f, 0.000000f, 0.343750f, 0.320312f, 0.421875f, 0.414062f, 46, 0},
+  {L'T', 10, 12, 0, 12, 9.781250f, 0.000000f, 0.515625f, 0.390625f, 0.593750f, 0.484375f, 46, 4},
+  {L'U', 10, 12, 1, 12, 11.562500f, 0.000000f, 0.601562f, 0.406250f, 0.679688f, 0.500000f, 50, 0},
+  {L'V', 11, 12, 0, 12, 10.671875f, 0.000000f, 0.226562f, 0.414062f, 0.312500f, 0.507812f, 50, 3},
+  {L'W', 15, 12, 0, 12, 15.109375f, 0.000000f, 0.007812f, 0.414062f, 0.125000f, 0.507812f, 53, 3},
+  {L'X', 11, 12, 0, 12, 10.671875f, 0.000000f, 0.687500f, 0.414062f, 0.773438f, 0.507812f, 56, 0},
+  {L'Y', 11, 12, 0, 12, 10.671875f, 0.000000f, 0.320312f, 0.421875f, 0.406250f, 0.515625f, 56, 4},
+  {L'Z', 10, 12, 0, 12, 9.781250f, 0.000000f, 0.429688f, 0.414062f, 0.507812f, 0.507812f, 60, 0},
+  {L'[', 4, 15, 1, 12, 4.453125f, 0.000000f, 0.945312f, 0.312500f, 0.976562f, 0.429688f, 60, 0},
+  {L'\\', 5, 12, 0, 12, 4.453125f, 0.000000f, 0.781250f, 0.414062f, 0.820312f, 0.507812f, 60, 0},
+  {L']', 4, 15, 0, 12, 4.453125f, 0.000000f, 0.828125f, 0.421875f, 0.859375f, 0.539062f, 60, 0},
+  {L'^', 8, 7, 0, 13, 7.515625f, 0.000000f, 0.867188f, 0.421875f, 0.929688f, 0.476562f, 60, 0},
+  {L'_', 11, 3, -1, -1, 8.906250f, 0.000000f, 0.132812f, 0.429688f, 0.218750f, 0.453125f, 60, 0},
+  {L'`', 4, 3, 0, 13, 5.328125f, 0.000000f, 0.937500f, 0.437500f, 0.968750f, 0.460938f, 60, 0},
+  {L'a', 9, 9, 0, 9, 8.906250f, 0.000000f, 0.132812f, 0.460938f, 0.203125f, 0.531250f, 60, 4},
+  {L'b', 8, 12, 1, 12, 8.906250f, 0.000000f, 0.867188f, 0.484375f, 0.929688f, 0.578125f, 64, 0},
+  {L'c', 8, 9, 0, 9, 8.000000f, 0.000000f, 0.515625f, 0.492188f, 0.578125f, 0.562500f, 64, 1},
+  {L'd', 8, 12, 0, 12, 8.906250f, 0.000000f, 0.585938f, 0.507812f, 0.648438f, 0.601562f, 65, 0},
+  {L'e', 9, 9, 0, 9, 8.906250f, 0.000000f, 0.210938f, 0.515625f, 0.281250f, 0.585938f, 65, 4},
+  {L'f', 5, 12, 0, 12, 4.453125f, 0.000000f, 0.937500f, 0.468750f, 0.976562f, 0.562500f, 69, 1},
+  {L'g', 8, 12, 0, 9, 8.906250f, 0.000000f, 0.414062f, 0.515625f, 0.476562f, 0.609375f, 70, 0},
+  {L'h', 7, 12, 1, 12, 8.906250f, 0.000000f, 0.656250f, 0.515625f, 0.710938f, 0.609375f, 70, 0},
+  {L'i', 2, 12, 1, 12, 3.562500f, 0.000000f, 0.289062f, 0.515625f, 0.304688f, 0.609375f, 70, 3},
+  {L'j', 4, 15, -1, 12, 3.562500f, 0.000000f, 0.718750f, 0.515625f, 0.750000f, 0.632812f, 73, 0},
+  {L'k', 7, 12, 1, 12, 8.000000f, 0.000000f, 0.757812f, 0.515625f, 0.812500f, 0.609375f, 73, 0},
+  {L'l', 2, 12, 1, 12, 3.562500f, 0.000000f, 0.484375f, 0.515625f, 0.500000f, 0.609375f, 73, 0},
+  {L'm', 12, 9, 1, 9, 13.328125f, 0.000000f, 0.007812f, 0.515625f, 0.101562f, 0.585938f, 73, 0},
+  {L'n', 7, 9, 1, 9, 8.906250f, 0.000000f, 0.312500f, 0.523438f, 0.367188f, 0.593750f, 73, 0},
+  {L'o', 9, 9, 0, 9, 8.906250f, 0.000000f, 0.109375f, 0.539062f, 0.179688f, 0.609375f, 73, 4},
+  {L'p', 8, 12, 1, 9, 8.906250f, 0.000000f, 0.507812f, 0.570312f, 0.570312f, 0.664062f, 77, 1},
+  {L'q', 8, 12, 0, 9, 8.906250f, 0.000000f, 0.820312f, 0.585938f, 0.882812f, 0.679688f, 78, 1},
+  {L'r', 5, 9, 1, 9, 5.328125f, 0.000000f, 0.937500f, 0.570312f, 0.976562f, 0.640625f, 79, 3},
+  {L's', 8, 9, 0, 9, 8.000000f, 0.000000f, 0.187500f, 0.593750f, 0.250000f, 0.664062f, 82, 1},
+  {L't', 5, 13, 0, 13, 4.453125f, 0.000000f, 0.890625f, 0.585938f, 0.929688f, 0.687500f, 83, 0},
+  {L'u', 7, 9, 1, 9, 8.906250f, 0.000000f, 0.007812f, 0.593750f, 0.062500f, 0.664062f, 83, 4},
+  {L'v', 8, 9, 0, 9, 8.000000f, 0.000000f, 0.312500f, 0.601562f, 0.375000f, 0.671875f, 87, 2},
+  {L'w', 12, 9, 0, 9, 11.562500f, 0.000000f, 0.578125f, 0.617188f, 0.671875f, 0.687500f, 89, 2},
+  {L'x', 8, 9, 0, 9, 8.000000f, 0.000000f, 0.382812f, 0.617188f, 0.445312f, 0.687500f, 91, 0},
+  {L'y', 8, 12, 0, 9, 8.000000f, 0.000000f, 0.070312f, 0.617188f, 0.132812f, 0.710938f, 91, 5},
+  {L'z', 8, 9, 0, 9, 8.000000f, 0.000000f, 0.679688f, 0.640625f, 0.742188f, 0.710938f, 96, 0},
+  {L'{', 5, 15, 0, 12, 5.343750f, 0.000000f, 0.257812f, 0.617188f, 0.296875f, 0.734375f, 96, 0},
+  {L'|', 2, 15, 1, 12, 4.156250f, 0.000000f, 0.140625f, 0.617188f, 0.156250f, 0.734375f, 96, 0},
+  {L'}', 5, 15, 0, 12, 5.343750f, 0.000000f, 0.453125f, 0.617188f, 0.492188f, 0.734375f, 96, 0},
+  {L'~', 9, 4, 0, 8, 9.343750f, 0.000000f, 0.500000f, 0.671875f, 0.570312f, 0.703125f, 96, 0},
+};
+
+const texture_font_t* arial_16pt() {
+    // Only the glyph lookup tables are built, the first time the font is used
+    static const texture_font_t font = texture_font_create(128, 128, 1, tex_data, 16.000000f, 18.400000f, 0.510000f, 14.490000f, -3.400000f, 96, glyphs, kerning);
+    return &font;
+}
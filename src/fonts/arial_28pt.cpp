@@ -44,9 +44,10 @@
 
 #include "glex/fonts/arial_28pt.h"
 
-texture_font_t arial_28pt = {
- 256, 256, 1, 
- {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// The font data is constexpr so it lives in read-only memory and costs nothing until the font is used
+
+static constexpr unsigned char tex_data[256 * 256 * 1] = {
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -2093,104 +2094,209 @@ texture_font_t arial_28pt = {
   0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 
- 28.000000f, 32.200001f, 0.910000f, 25.350000f, -5.940000f, 96, 
- {
-  {L'\0', 0, 0, 0, 0, 0.000000f, 0.000000f, 0.011719f, 0.011719f, 0.015625f, 0.015625f, 0, { } },
-  {L' ', 0, 0, 0, 0, 7.781250f, 0.000000f, 0.023438f, 0.003906f, 0.023438f, 0.003906f, 5, { {L'A', -1.544922f}, {L'L', -1.039062f}, {L'P', -0.505859f}, {L'T', -0.505859f}, {L'Y', -0.505859f}} },
-  {L'!', 4, 20, 2, 20, 7.781250f, 0.000000f, 0.027344f, 0.003906f, 0.042969f, 0.082031f, 0, { } },
-  {L'"', 8, 7, 1, 20, 9.937500f, 0.000000f, 0.046875f, 0.003906f, 0.078125f, 0.031250f, 0, { } },
-  {L'#', 16, 20, 0, 20, 15.578125f, 0.000000f, 0.082031f, 0.003906f, 0.144531f, 0.082031f, 0, { } },
-  {L'$', 14, 26, 1, 23, 15.578125f, 0.000000f, 0.148438f, 0.003906f, 0.203125f, 0.105469f, 0, { } },
-  {L'%', 23, 20, 1, 20, 24.890625f, 0.000000f, 0.207031f, 0.003906f, 0.296875f, 0.082031f, 0, { } },
-  {L'&', 18, 21, 1, 20, 18.671875f, 0.000000f, 0.300781f, 0.003906f, 0.371094f, 0.085938f, 0, { } },
-  {L'\'', 4, 7, 1, 20, 5.343750f, 0.000000f, 0.375000f, 0.003906f, 0.390625f, 0.031250f, 0, { } },
-  {L'(', 8, 26, 1, 20, 9.328125f, 0.000000f, 0.394531f, 0.003906f, 0.425781f, 0.105469f, 0, { } },
-  {L')', 8, 26, 1, 20, 9.328125f, 0.000000f, 0.429688f, 0.003906f, 0.460938f, 0.105469f, 0, { } },
-  {L'*', 10, 9, 0, 20, 10.890625f, 0.000000f, 0.464844f, 0.003906f, 0.503906f, 0.039062f, 0, { } },
-  {L'+', 14, 13, 1, 16, 16.359375f, 0.000000f, 0.507812f, 0.003906f, 0.562500f, 0.054688f, 0, { } },
-  {L',', 4, 7, 2, 3, 7.781250f, 0.000000f, 0.566406f, 0.003906f, 0.582031f, 0.031250f, 10, { {L'F', -3.103516f}, {L'P', -3.609375f}, {L'T', -3.103516f}, {L'V', -2.570312f}, {L'W', -1.544922f}, {L'Y', -3.609375f}, {L'r', -1.544922f}, {L'v', -2.078125f}, {L'w', -1.544922f}, {L'y', -2.078125f}} },
-  {L'-', 9, 3, 0, 9, 9.328125f, 0.000000f, 0.585938f, 0.003906f, 0.621094f, 0.015625f, 4, { {L'T', -1.544922f}, {L'V', -1.544922f}, {L'W', -0.505859f}, {L'Y', -2.570312f}} },
-  {L'.', 4, 3, 2, 3, 7.781250f, 0.000000f, 0.625000f, 0.003906f, 0.640625f, 0.015625f, 10, { {L'F', -3.103516f}, {L'P', -3.609375f}, {L'T', -3.103516f}, {L'V', -2.570312f}, {L'W', -1.544922f}, {L'Y', -3.609375f}, {L'r', -1.544922f}, {L'v', -2.078125f}, {L'w', -1.544922f}, {L'y', -2.078125f}} },
-  {L'/', 8, 20, 0, 20, 7.781250f, 0.000000f, 0.644531f, 0.003906f, 0.675781f, 0.082031f, 0, { } },
-  {L'0', 14, 20, 1, 20, 15.578125f, 0.000000f, 0.679688f, 0.003906f, 0.734375f, 0.082031f, 0, { } },
-  {L'1', 8, 20, 3, 20, 15.578125f, 0.000000f, 0.738281f, 0.003906f, 0.769531f, 0.082031f, 1, { {L'1', -2.078125f}} },
-  {L'2', 15, 20, 0, 20, 15.578125f, 0.000000f, 0.773438f, 0.003906f, 0.832031f, 0.082031f, 0, { } },
-  {L'3', 14, 20, 1, 20, 15.578125f, 0.000000f, 0.835938f, 0.003906f, 0.890625f, 0.082031f, 0, { } },
-  {L'4', 15, 20, 0, 20, 15.578125f, 0.000000f, 0.894531f, 0.003906f, 0.953125f, 0.082031f, 0, { } },
-  {L'5', 14, 20, 1, 20, 15.578125f, 0.000000f, 0.585938f, 0.019531f, 0.640625f, 0.097656f, 0, { } },
-  {L'6', 14, 20, 1, 20, 15.578125f, 0.000000f, 0.464844f, 0.058594f, 0.519531f, 0.136719f, 0, { } },
-  {L'7', 14, 20, 1, 20, 15.578125f, 0.000000f, 0.523438f, 0.058594f, 0.578125f, 0.136719f, 0, { } },
-  {L'8', 14, 20, 1, 20, 15.578125f, 0.000000f, 0.023438f, 0.085938f, 0.078125f, 0.164062f, 0, { } },
-  {L'9', 14, 20, 1, 20, 15.578125f, 0.000000f, 0.082031f, 0.085938f, 0.136719f, 0.164062f, 0, { } },
-  {L':', 4, 15, 2, 15, 7.781250f, 0.000000f, 0.957031f, 0.003906f, 0.972656f, 0.062500f, 4, { {L'T', -3.103516f}, {L'V', -1.039062f}, {L'W', -0.505859f}, {L'Y', -1.544922f}} },
-  {L';', 4, 19, 2, 15, 7.781250f, 0.000000f, 0.976562f, 0.003906f, 0.992188f, 0.078125f, 4, { {L'T', -3.103516f}, {L'V', -1.039062f}, {L'W', -0.505859f}, {L'Y', -1.818359f}} },
-  {L'<', 14, 14, 1, 17, 16.359375f, 0.000000f, 0.207031f, 0.085938f, 0.261719f, 0.140625f, 0, { } },
-  {L'=', 14, 9, 1, 15, 16.359375f, 0.000000f, 0.644531f, 0.085938f, 0.699219f, 0.121094f, 0, { } },
-  {L'>', 14, 14, 1, 17, 16.359375f, 0.000000f, 0.703125f, 0.085938f, 0.757812f, 0.140625f, 0, { } },
-  {L'?', 14, 20, 1, 20, 15.578125f, 0.000000f, 0.761719f, 0.085938f, 0.816406f, 0.164062f, 0, { } },
-  {L'@', 27, 26, 1, 20, 28.421875f, 0.000000f, 0.820312f, 0.085938f, 0.925781f, 0.187500f, 0, { } },
-  {L'A', 20, 20, -1, 20, 18.671875f, 0.000000f, 0.265625f, 0.089844f, 0.343750f, 0.167969f, 7, { {L' ', -1.544922f}, {L'F', -1.544922f}, {L'P', -2.078125f}, {L'T', -2.078125f}, {L'V', -2.078125f}, {L'W', -1.039062f}, {L'Y', -2.078125f}} },
-  {L'B', 16, 20, 2, 20, 18.671875f, 0.000000f, 0.929688f, 0.085938f, 0.992188f, 0.164062f, 0, { } },
-  {L'C', 19, 20, 1, 20, 20.218750f, 0.000000f, 0.375000f, 0.109375f, 0.449219f, 0.187500f, 0, { } },
-  {L'D', 17, 20, 2, 20, 20.218750f, 0.000000f, 0.582031f, 0.125000f, 0.648438f, 0.203125f, 0, { } },
-  {L'E', 16, 20, 2, 20, 18.671875f, 0.000000f, 0.140625f, 0.109375f, 0.203125f, 0.187500f, 0, { } },
-  {L'F', 14, 20, 2, 20, 17.109375f, 0.000000f, 0.453125f, 0.140625f, 0.507812f, 0.218750f, 0, { } },
-  {L'G', 20, 20, 1, 20, 21.781250f, 0.000000f, 0.652344f, 0.144531f, 0.730469f, 0.222656f, 0, { } },
-  {L'H', 16, 20, 2, 20, 20.218750f, 0.000000f, 0.511719f, 0.140625f, 0.574219f, 0.218750f, 0, { } },
-  {L'I', 4, 20, 2, 20, 7.781250f, 0.000000f, 0.003906f, 0.023438f, 0.019531f, 0.101562f, 0, { } },
-  {L'J', 12, 20, 0, 20, 14.000000f, 0.000000f, 0.207031f, 0.144531f, 0.253906f, 0.222656f, 0, { } },
-  {L'K', 17, 20, 2, 20, 18.671875f, 0.000000f, 0.003906f, 0.167969f, 0.070312f, 0.246094f, 0, { } },
-  {L'L', 13, 20, 2, 20, 15.578125f, 0.000000f, 0.734375f, 0.167969f, 0.785156f, 0.246094f, 0, { } },
-  {L'M', 20, 20, 2, 20, 23.328125f, 0.000000f, 0.257812f, 0.171875f, 0.335938f, 0.250000f, 0, { } },
-  {L'N', 16, 20, 2, 20, 20.218750f, 0.000000f, 0.074219f, 0.167969f, 0.136719f, 0.246094f, 0, { } },
-  {L'O', 20, 20, 1, 20, 21.781250f, 0.000000f, 0.339844f, 0.191406f, 0.417969f, 0.269531f, 1, { {L'T', -0.505859f}} },
-  {L'P', 16, 20, 2, 20, 18.671875f, 0.000000f, 0.929688f, 0.167969f, 0.992188f, 0.246094f, 0, { } },
-  {L'Q', 20, 22, 1, 20, 21.781250f, 0.000000f, 0.789062f, 0.191406f, 0.867188f, 0.277344f, 0, { } },
-  {L'R', 18, 20, 2, 20, 20.218750f, 0.000000f, 0.578125f, 0.207031f, 0.648438f, 0.285156f, 0, { } },
-  {L'S', 17, 20, 1, 20, 18.671875f, 0.000000f, 0.421875f, 0.222656f, 0.488281f, 0.300781f, 0, { } },
-  {L'T', 17, 20, 0, 20, 17.109375f, 0.000000f, 0.492188f, 0.222656f, 0.558594f, 0.300781f, 4, { {L' ', -0.505859f}, {L'A', -2.078125f}, {L'L', -2.078125f}, {L'R', -0.505859f}} },
-  {L'U', 16, 20, 2, 20, 20.218750f, 0.000000f, 0.140625f, 0.191406f, 0.203125f, 0.269531f, 0, { } },
-  {L'V', 19, 20, 0, 20, 18.671875f, 0.000000f, 0.652344f, 0.226562f, 0.726562f, 0.304688f, 3, { {L'A', -2.078125f}, {L'L', -2.078125f}, {L'R', -0.505859f}} },
-  {L'W', 27, 20, 0, 20, 26.421875f, 0.000000f, 0.871094f, 0.250000f, 0.976562f, 0.328125f, 3, { {L'A', -1.039062f}, {L'L', -2.078125f}, {L'R', -0.505859f}} },
-  {L'X', 19, 20, 0, 20, 18.671875f, 0.000000f, 0.003906f, 0.250000f, 0.078125f, 0.328125f, 0, { } },
-  {L'Y', 19, 20, 0, 20, 18.671875f, 0.000000f, 0.207031f, 0.253906f, 0.281250f, 0.332031f, 4, { {L' ', -0.505859f}, {L'A', -2.078125f}, {L'L', -2.078125f}, {L'R', -0.505859f}} },
-  {L'Z', 17, 20, 0, 20, 17.109375f, 0.000000f, 0.285156f, 0.273438f, 0.351562f, 0.351562f, 0, { } },
-  {L'[', 7, 26, 1, 20, 7.781250f, 0.000000f, 0.730469f, 0.250000f, 0.757812f, 0.351562f, 0, { } },
-  {L'\\', 8, 20, 0, 20, 7.781250f, 0.000000f, 0.082031f, 0.250000f, 0.113281f, 0.328125f, 0, { } },
-  {L']', 6, 26, 0, 20, 7.781250f, 0.000000f, 0.761719f, 0.250000f, 0.785156f, 0.351562f, 0, { } },
-  {L'^', 13, 11, 0, 21, 13.140625f, 0.000000f, 0.117188f, 0.273438f, 0.167969f, 0.316406f, 0, { } },
-  {L'_', 17, 3, -1, -3, 15.578125f, 0.000000f, 0.789062f, 0.281250f, 0.855469f, 0.292969f, 0, { } },
-  {L'`', 6, 4, 1, 21, 9.328125f, 0.000000f, 0.171875f, 0.273438f, 0.195312f, 0.289062f, 0, { } },
-  {L'a', 14, 15, 1, 15, 15.578125f, 0.000000f, 0.355469f, 0.273438f, 0.410156f, 0.332031f, 4, { {L'T', -3.103516f}, {L'V', -2.078125f}, {L'W', -1.039062f}, {L'Y', -2.078125f}} },
-  {L'b', 14, 20, 1, 20, 15.578125f, 0.000000f, 0.562500f, 0.289062f, 0.617188f, 0.367188f, 0, { } },
-  {L'c', 13, 15, 1, 15, 14.000000f, 0.000000f, 0.789062f, 0.296875f, 0.839844f, 0.355469f, 1, { {L'T', -3.103516f}} },
-  {L'd', 14, 20, 0, 20, 15.578125f, 0.000000f, 0.414062f, 0.304688f, 0.468750f, 0.382812f, 0, { } },
-  {L'e', 14, 15, 1, 15, 15.578125f, 0.000000f, 0.472656f, 0.304688f, 0.527344f, 0.363281f, 4, { {L'T', -3.103516f}, {L'V', -1.544922f}, {L'W', -0.505859f}, {L'Y', -2.570312f}} },
-  {L'f', 9, 20, 0, 20, 7.781250f, 0.000000f, 0.621094f, 0.308594f, 0.656250f, 0.386719f, 1, { {L'f', -0.505859f}} },
-  {L'g', 14, 21, 0, 15, 15.578125f, 0.000000f, 0.660156f, 0.308594f, 0.714844f, 0.390625f, 0, { } },
-  {L'h', 13, 20, 1, 20, 15.578125f, 0.000000f, 0.117188f, 0.320312f, 0.167969f, 0.398438f, 0, { } },
-  {L'i', 4, 20, 1, 20, 6.218750f, 0.000000f, 0.171875f, 0.292969f, 0.187500f, 0.371094f, 3, { {L'T', -1.039062f}, {L'V', -0.505859f}, {L'Y', -1.039062f}} },
-  {L'j', 7, 26, -2, 20, 6.218750f, 0.000000f, 0.531250f, 0.304688f, 0.558594f, 0.406250f, 0, { } },
-  {L'k', 13, 20, 1, 20, 14.000000f, 0.000000f, 0.859375f, 0.332031f, 0.910156f, 0.410156f, 0, { } },
-  {L'l', 4, 20, 1, 20, 6.218750f, 0.000000f, 0.914062f, 0.332031f, 0.929688f, 0.410156f, 0, { } },
-  {L'm', 21, 15, 1, 15, 23.328125f, 0.000000f, 0.003906f, 0.332031f, 0.085938f, 0.390625f, 0, { } },
-  {L'n', 13, 15, 1, 15, 15.578125f, 0.000000f, 0.933594f, 0.332031f, 0.984375f, 0.390625f, 0, { } },
-  {L'o', 15, 15, 0, 15, 15.578125f, 0.000000f, 0.191406f, 0.335938f, 0.250000f, 0.394531f, 4, { {L'T', -3.103516f}, {L'V', -1.544922f}, {L'W', -0.505859f}, {L'Y', -2.570312f}} },
-  {L'p', 14, 21, 1, 15, 15.578125f, 0.000000f, 0.355469f, 0.335938f, 0.410156f, 0.417969f, 1, { {L'Y', -2.078125f}} },
-  {L'q', 14, 21, 0, 15, 15.578125f, 0.000000f, 0.718750f, 0.355469f, 0.773438f, 0.437500f, 1, { {L'Y', -2.570312f}} },
-  {L'r', 9, 15, 1, 15, 9.328125f, 0.000000f, 0.253906f, 0.355469f, 0.289062f, 0.414062f, 3, { {L'T', -1.039062f}, {L'V', -1.039062f}, {L'W', -0.505859f}} },
-  {L's', 13, 15, 0, 15, 14.000000f, 0.000000f, 0.292969f, 0.355469f, 0.343750f, 0.414062f, 1, { {L'T', -3.103516f}} },
-  {L't', 8, 21, 0, 21, 7.781250f, 0.000000f, 0.777344f, 0.359375f, 0.808594f, 0.441406f, 0, { } },
-  {L'u', 13, 15, 1, 15, 15.578125f, 0.000000f, 0.472656f, 0.367188f, 0.523438f, 0.425781f, 4, { {L'T', -1.039062f}, {L'V', -1.039062f}, {L'W', -0.505859f}, {L'Y', -1.544922f}} },
-  {L'v', 14, 15, 0, 15, 14.000000f, 0.000000f, 0.562500f, 0.371094f, 0.617188f, 0.429688f, 2, { {L'A', -0.505859f}, {L'Y', -1.544922f}} },
-  {L'w', 20, 15, 0, 15, 20.218750f, 0.000000f, 0.621094f, 0.394531f, 0.699219f, 0.453125f, 2, { {L'A', -0.505859f}, {L'T', -1.544922f}} },
-  {L'x', 14, 15, 0, 15, 14.000000f, 0.000000f, 0.414062f, 0.386719f, 0.468750f, 0.445312f, 0, { } },
-  {L'y', 14, 21, 0, 15, 14.000000f, 0.000000f, 0.933594f, 0.394531f, 0.988281f, 0.476562f, 5, { {L'A', -0.505859f}, {L'L', -1.039062f}, {L'T', -1.544922f}, {L'V', -1.039062f}, {L'W', -0.246094f}} },
-  {L'z', 14, 15, 0, 15, 14.000000f, 0.000000f, 0.003906f, 0.394531f, 0.058594f, 0.453125f, 0, { } },
-  {L'{', 9, 26, 0, 20, 9.359375f, 0.000000f, 0.812500f, 0.359375f, 0.847656f, 0.460938f, 0, { } },
-  {L'|', 3, 26, 2, 20, 7.281250f, 0.000000f, 0.089844f, 0.332031f, 0.101562f, 0.433594f, 0, { } },
-  {L'}', 9, 26, 0, 20, 9.359375f, 0.000000f, 0.171875f, 0.398438f, 0.207031f, 0.500000f, 0, { } },
-  {L'~', 15, 6, 1, 13, 16.359375f, 0.000000f, 0.105469f, 0.402344f, 0.164062f, 0.425781f, 0, { } },
- }
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+static constexpr kerning_t kerning[96] = {
+  {L'A', -1.544922f},
+  {L'L', -1.039062f},
+  {L'P', -0.505859f},
+  {L'T', -0.505859f},
+  {L'Y', -0.505859f},
+  {L'F', -3.103516f},
+  {L'P', -3.609375f},
+  {L'T', -3.103516f},
+  {L'V', -2.570312f},
+  {L'W', -1.544922f},
+  {L'Y', -3.609375f},
+  {L'r', -1.544922f},
+  {L'v', -2.078125f},
+  {L'w', -1.544922f},
+  {L'y', -2.078125f},
+  {L'T', -1.544922f},
+  {L'V', -1.544922f},
+  {L'W', -0.505859f},
+  {L'Y', -2.570312f},
+  {L'F', -3.103516f},
+  {L'P', -3.609375f},
+  {L'T', -3.103516f},
+  {L'V', -2.570312f},
+  {L'W', -1.544922f},
+  {L'Y', -3.609375f},
+  {L'r', -1.544922f},
+  {L'v', -2.078125f},
+  {L'w', -1.544922f},
+  {L'y', -2.078125f},
+  {L'1', -2.078125f},
+  {L'T', -3.103516f},
+  {L'V', -1.039062f},
+  {L'W', -0.505859f},
+  {L'Y', -1.544922f},
+  {L'T', -3.103516f},
+  {L'V', -1.039062f},
+  {L'W', -0.505859f},
+  {L'Y', -1.818359f},
+  {L' ', -1.544922f},
+  {L'F', -1.544922f},
+  {L'P', -2.078125f},
+  {L'T', -2.078125f},
+  {L'V', -2.078125f},
+  {L'W', -1.039062f},
+  {L'Y', -2.078125f},
+  {L'T', -0.505859f},
+  {L' ', -0.505859f},
+  {L'A', -2.078125f},
+  {L'L', -2.078125f},
+  {L'R', -0.505859f},
+  {L'A', -2.078125f},
+  {L'L', -2.078125f},
+  {L'R', -0.505859f},
+  {L'A', -1.039062f},
+  {L'L', -2.078125f},
+  {L'R', -0.505859f},
+  {L' ', -0.505859f},
+  {L'A', -2.078125f},
+  {L'L', -2.078125f},
+  {L'R', -0.505859f},
+  {L'T', -3.103516f},
+  {L'V', -2.078125f},
+  {L'W', -1.039062f},
+  {L'Y', -2.078125f},
+  {L'T', -3.103516f},
+  {L'T', -3.103516f},
+  {L'V', -1.544922f},
+  {L'W', -0.505859f},
+  {L'Y', -2.570312f},
+  {L'f', -0.505859f},
+  {L'T', -1.039062f},
+  {L'V', -0.505859f},
+  {L'Y', -1.039062f},
+  {L'T', -3.103516f},
+  {L'V', -1.544922f},
+  {L'W', -0.505859f},
+  {L'Y', -2.570312f},
+  {L'Y', -2.078125f},
+  {L'Y', -2.570312f},
+  {L'T', -1.039062f},
+  {L'V', -1.039062f},
+  {L'W', -0.505859f},
+  {L'T', -3.103516f},
+  {L'T', -1.039062f},
+  {L'V', -1.039062f},
+  {L'W', -0.505859f},
+  {L'Y', -1.544922f},
+  {L'A', -0.505859f},
+  {L'Y', -1.544922f},
+  {L'A', -0.505859f},
+  {L'T', -1.544922f},
+  {L'A', -0.505859f},
+  {L'L', -1.039062f},
+  {L'T', -1.544922f},
+  {L'V', -1.039062f},
+  {L'W', -0.246094f},
 };
+
+static constexpr texture_glyph_t glyphs[96] = {
+  {L'\0', 0, 0, 0, 0, 0.000000f, 0.000000f, 0.011719f, 0.011719f, 0.015625f, 0.015625f, 0, 0},
+  {L' ', 0, 0, 0, 0, 7.781250f, 0.000000f, 0.023438f, 0.003906f, 0.023438f, 0.003906f, 0, 5},
+  {L'!', 4, 20, 2, 20, 7.781250f, 0.000000f, 0.027344f, 0.003906f, 0.042969f, 0.082031f, 5, 0},
+  {L'"', 8, 7, 1, 20, 9.937500f, 0.000000f, 0.046875f, 0.003906f, 0.078125f, 0.031250f, 5, 0},
+  {L'#', 16, 20, 0, 20, 15.578125f, 0.000000f, 0.082031f, 0.003906f, 0.144531f, 0.082031f, 5, 0},
+  {L'$', 14, 26, 1, 23, 15.578125f, 0.000000f, 0.148438f, 0.003906f, 0.203125f, 0.105469f, 5, 0},
+  {L'%', 23, 20, 1, 20, 24.890625f, 0.000000f, 0.207031f, 0.003906f, 0.296875f, 0.082031f, 5, 0},
+  {L'&', 18, 21, 1, 20, 18.671875f, 0.000000f, 0.300781f, 0.003906f, 0.371094f, 0.085938f, 5, 0},
+  {L'\'', 4, 7, 1, 20, 5.343750f, 0.000000f, 0.375000f, 0.003906f, 0.390625f, 0.031250f, 5, 0},
+  {L'(', 8, 26, 1, 20, 9.328125f, 0.000000f, 0.394531f, 0.003906f, 0.425781f, 0.105469f, 5, 0},
+  {L')', 8, 26, 1, 20, 9.328125f, 0.000000f, 0.429688f, 0.003906f, 0.460938f, 0.105469f, 5, 0},
+  {L'*', 10, 9, 0, 20, 10.890625f, 0.000000f, 0.464844f, 0.003906f, 0.503906f, 0.039062f, 5, 0},
+  {L'+', 14, 13, 1, 16, 16.359375f, 0.000000f, 0.507812f, 0.003906f, 0.562500f, 0.054688f, 5, 0},
+  {L',', 4, 7, 2, 3, 7.781250f, 0.000000f, 0.566406f, 0.003906f, 0.582031f, 0.031250f, 5, 10},
+  {L'-', 9, 3, 0, 9, 9.328125f, 0.000000f, 0.585938f, 0.003906f, 0.621094f, 0.015625f, 15, 4},
+  {L'.', 4, 3, 2, 3, 7.781250f, 0.000000f, 0.625000f, 0.003906f, 0.640625f, 0.015625f, 19, 10},
+  {L'/', 8, 20, 0, 20, 7.781250f, 0.000000f, 0.644531f, 0.003906f, 0.675781f, 0.082031f, 29, 0},
+  {L'0', 14, 20, 1, 20, 15.578125f, 0.000000f, 0.679688f, 0.003906f, 0.734375f, 0.082031f, 29, 0},
+  {L'1', 8, 20, 3, 20, 15.578125f, 0.000000f, 0.738281f, 0.003906f, 0.769531f, 0.082031f, 29, 1},
+  {L'2', 15, 20, 0, 20, 15.578125f, 0.000000f, 0.773438f, 0.003906f, 0.832031f, 0.082031f, 30, 0},
+  {L'3', 14, 20, 1, 20, 15.578125f, 0.000000f, 0.835938f, 0.003906f, 0.890625f, 0.082031f, 30, 0},
+  {L'4', 15, 20, 0, 20, 15.578125f, 0.000000f, 0.894531f, 0.003906f, 0.953125f, 0.082031f, 30, 0},
+  {L'5', 14, 20, 1, 20, 15.578125f, 0.000000f, 0.585938f, 0.019531f, 0.640625f, 0.097656f, 30, 0},
+  {L'6', 14, 20, 1, 20, 15.578125f, 0.000000f, 0.464844f, 0.058594f, 0.519531f, 0.136719f, 30, 0},
+  {L'7', 14, 20, 1, 20, 15.578125f, 0.000000f, 0.523438f, 0.058594f, 0.578125f, 0.136719f, 30, 0},
+  {L'8', 14, 20, 1, 20, 15.578125f, 0.000000f, 0.023438f, 0.085938f, 0.078125f, 0.164062f, 30, 0},
+  {L'9', 14, 20, 1, 20, 15.578125f, 0.000000f, 0.082031f, 0.085938f, 0.136719f, 0.164062f, 30, 0},
+  {L':', 4, 15, 2, 15, 7.781250f, 0.000000f, 0.957031f, 0.003906f, 0.972656f, 0.062500f, 30, 4},
+  {L';', 4, 19, 2, 15, 7.781250f, 0.000000f, 0.976562f, 0.003906f, 0.992188f, 0.078125f, 34, 4},
+  {L'<', 14, 14, 1, 17, 16.359375f, 0.000000f, 0.207031f, 0.085938f, 0.261719f, 0.140625f, 38, 0},
+  {L'=', 14, 9, 1, 15, 16.359375f, 0.000000f, 0.644531f, 0.085938f, 0.699219f, 0.121094f, 38, 0},
+  {L'>', 14, 14, 1, 17, 16.359375f, 0.000000f, 0.703125f, 0.085938f, 0.757812f, 0.140625f, 38, 0},
+  {L'?', 14, 20, 1, 20, 15.578125f, 0.000000f, 0.761719f, 0.085938f, 0.816406f, 0.164062f, 38, 0},
+  {L'@', 27, 26, 1, 20, 28.421875f, 0.000000f, 0.820312f, 0.085938f, 0.925781f, 0.187500f, 38, 0},
+  {L'A', 20, 20, -1, 20, 18.671875f, 0.000000f, 0.265625f, 0.089844f, 0.343750f, 0.167969f, 38, 7},
+  {L'B', 16, 20, 2, 20, 18.671875f, 0.000000f, 0.929688f, 0.085938f, 0.992188f, 0.164062f, 45, 0},
+  {L'C', 19, 20, 1, 20, 20.218750f, 0.000000f, 0.375000f, 0.109375f, 0.449219f, 0.187500f, 45, 0},
+  {L'D', 17, 20, 2, 20, 20.218750f, 0.000000f, 0.582031f, 0.125000f, 0.648438f, 0.203125f, 45, 0},
+  {L'E', 16, 20, 2, 20, 18.671875f, 0.000000f, 0.140625f, 0.109375f, 0.203125f, 0.187500f, 45, 0},
+  {L'F', 14, 20, 2, 20, 17.109375f, 0.000000f, 0.453125f, 0.140625f, 0.507812f, 0.218750f, 45, 0},
+  {L'G', 20, 20, 1, 20, 21.781250f, 0.000000f, 0.652344f, 0.144531f, 0.730469f, 0.222656f, 45, 0},
+  {L'H', 16, 20, 2, 20, 20.218750f, 0.000000f, 0.511719f, 0.140625f, 0.574219f, 0.218750f, 45, 0},
+  {L'I', 4, 20, 2, 20, 7.781250f, 0.000000f, 0.003906f, 0.023438f, 0.019531f, 0.101562f, 45, 0},
+  {L'J', 12, 20, 0, 20, 14.000000f, 0.000000f, 0.207031f, 0.144531f, 0.253906f, 0.222656f, 45, 0},
+  {L'K', 17, 20, 2, 20, 18.671875f, 0.000000f, 0.003906f, 0.167969f, 0.070312f, 0.246094f, 45, 0},
+  {L'L', 13, 20, 2, 20, 15.578125f, 0.000000f, 0.734375f, 0.167969f, 0.785156f, 0.246094f, 45, 0},
+  {L'M', 20, 20, 2, 20, 23.328125f, 0.000000f, 0.257812f, 0.171875f, 0.335938f, 0.250000f, 45, 0},
+  {L'N', 16, 20, 2, 20, 20.218750f, 0.000000f, 0.074219f, 0.167969f, 0.136719f, 0.246094f, 45, 0},
+  {L'O', 20, 20, 1, 20, 21.781250f, 0.000000f, 0.339844f, 0.191406f, 0.417969f, 0.269531f, 45, 1},
+  {L'P', 16, 20, 2, 20, 18.671875f, 0.000000f, 0.929688f, 0.167969f, 0.992188f, 0.246094f, 46, 0},
+  {L'Q', 20, 22, 1, 20, 21.781250f, 0.000000f, 0.789062f, 0.191406f, 0.867188f, 0.277344f, 46, 0},
+  {L'R', 18, 20, 2, 20, 20.218750f, 0.000000f, 0.578125f, 0.207031f, 0.648438f, 0.285156f, 46, 0},
+  {L'S', 17, 20, 1, 20, 18.671875f, 0.000000f, 0.421875f, 0.222656f, 0.488281f, 0.300781f, 46, 0},
+  {L'T', 17, 20, 0, 20, 17.109375f, 0.000000f, 0.492188f, 0.222656f, 0.558594f, 0.300781f, 46, 4},
+  {L'U', 16, 20, 2, 20, 20.218750f, 0.000000f, 0.140625f, 0.191406f, 0.203125f, 0.269531f, 50, 0},
+  {L'V', 19, 20, 0, 20, 18.671875f, 0.000000f, 0.652344f, 0.226562f, 0.726562f, 0.304688f, 50, 3},
+  {L'W', 27, 20, 0, 20, 26.421875f, 0.000000f, 0.871094f, 0.250000f, 0.976562f, 0.328125f, 53, 3},
+  {L'X', 19, 20, 0, 20, 18.671875f, 0.000000f, 0.003906f, 0.250000f, 0.078125f, 0.328125f, 56, 0},
+  {L'Y', 19, 20, 0, 20, 18.671875f, 0.000000f, 0.207031f, 0.253906f, 0.281250f, 0.332031f, 56, 4},
+  {L'Z', 17, 20, 0, 20, 17.109375f, 0.000000f, 0.285156f, 0.273438f, 0.351562f, 0.351562f, 60, 0},
+  {L'[', 7, 26, 1, 20, 7.781250f, 0.000000f, 0.730469f, 0.250000f, 0.757812f, 0.351562f, 60, 0},
+  {L'\\', 8, 20, 0, 20, 7.781250f, 0.000000f, 0.082031f, 0.250000f, 0.113281f, 0.328125f, 60, 0},
+  {L']', 6, 26, 0, 20, 7.781250f, 0.000000f, 0.761719f, 0.250000f, 0.785156f, 0.351562f, 60, 0},
+  {L'^', 13, 11, 0, 21, 13.140625f, 0.000000f, 0.117188f, 0.273438f, 0.167969f, 0.316406f, 60, 0},
+  {L'_', 17, 3, -1, -3, 15.578125f, 0.000000f, 0.789062f, 0.281250f, 0.855469f, 0.292969f, 60, 0},
+  {L'`', 6, 4, 1, 21, 9.328125f, 0.000000f, 0.171875f, 0.273438f, 0.195312f, 0.289062f, 60, 0},
+  {L'a', 14, 15, 1, 15, 15.578125f, 0.000000f, 0.355469f, 0.273438f, 0.410156f, 0.332031f, 60, 4},
+  {L'b', 14, 20, 1, 20, 15.578125f, 0.000000f, 0.562500f, 0.289062f, 0.617188f, 0.367188f, 64, 0},
+  {L'c', 13, 15, 1, 15, 14.000000f, 0.000000f, 0.789062f, 0.296875f, 0.839844f, 0.355469f, 64, 1},
+  {L'd', 14, 20, 0, 20, 15.578125f, 0.000000f, 0.414062f, 0.304688f, 0.468750f, 0.382812f, 65, 0},
+  {L'e', 14, 15, 1, 15, 15.578125f, 0.000000f, 0.472656f, 0.304688f, 0.527344f, 0.363281f, 65, 4},
+  {L'f', 9, 20, 0, 20, 7.781250f, 0.000000f, 0.621094f, 0.308594f, 0.656250f, 0.386719f, 69, 1},
+  {L'g', 14, 21, 0, 15, 15.578125f, 0.000000f, 0.660156f, 0.308594f, 0.714844f, 0.390625f, 70, 0},
+  {L'h', 13, 20, 1, 20, 15.578125f, 0.000000f, 0.117188f, 0.320312f, 0.167969f, 0.398438f, 70, 0},
+  {L'i', 4, 20, 1, 20, 6.218750f, 0.000000f, 0.171875f, 0.292969f, 0.187500f, 0.371094f, 70, 3},
+  {L'j', 7, 26, -2, 20, 6.218750f, 0.000000f, 0.531250f, 0.304688f, 0.558594f, 0.406250f, 73, 0},
+  {L'k', 13, 20, 1, 20, 14.000000f, 0.000000f, 0.859375f, 0.332031f, 0.910156f, 0.410156f, 73, 0},
+  {L'l', 4, 20, 1, 20, 6.218750f, 0.000000f, 0.914062f, 0.332031f, 0.929688f, 0.410156f, 73, 0},
+  {L'm', 21, 15, 1, 15, 23.328125f, 0.000000f, 0.003906f, 0.332031f, 0.085938f, 0.390625f, 73, 0},
+  {L'n', 13, 15, 1, 15, 15.578125f, 0.000000f, 0.933594f, 0.332031f, 0.984375f, 0.390625f, 73, 0},
+  {L'o', 15, 15, 0, 15, 15.578125f, 0.000000f, 0.191406f, 0.335938f, 0.250000f, 0.394531f, 73, 4},
+  {L'p', 14, 21, 1, 15, 15.578125f, 0.000000f, 0.355469f, 0.335938f, 0.410156f, 0.417969f, 77, 1},
+  {L'q', 14, 21, 0, 15, 15.578125f, 0.000000f, 0.718750f, 0.355469f, 0.773438f, 0.437500f, 78, 1},
+  {L'r', 9, 15, 1, 15, 9.328125f, 0.000000f, 0.253906f, 0.355469f, 0.289062f, 0.414062f, 79, 3},
+  {L's', 13, 15, 0, 15, 14.000000f, 0.000000f, 0.292969f, 0.355469f, 0.343750f, 0.414062f, 82, 1},
+  {L't', 8, 21, 0, 21, 7.781250f, 0.000000f, 0.777344f, 0.359375f, 0.808594f, 0.441406f, 83, 0},
+  {L'u', 13, 15, 1, 15, 15.578125f, 0.000000f, 0.472656f, 0.367188f, 0.523438f, 0.425781f, 83, 4},
+  {L'v', 14, 15, 0, 15, 14.000000f, 0.000000f, 0.562500f, 0.371094f, 0.617188f, 0.429688f, 87, 2},
+  {L'w', 20, 15, 0, 15, 20.218750f, 0.000000f, 0.621094f, 0.394531f, 0.699219f, 0.453125f, 89, 2},
+  {L'x', 14, 15, 0, 15, 14.000000f, 0.000000f, 0.414062f, 0.386719f, 0.468750f, 0.445312f, 91, 0},
+  {L'y', 14, 21, 0, 15, 14.000000f, 0.000000f, 0.933594f, 0.394531f, 0.988281f, 0.476562f, 91, 5},
+  {L'z', 14, 15, 0, 15, 14.000000f, 0.000000f, 0.003906f, 0.394531f, 0.058594f, 0.453125f, 96, 0},
+  {L'{', 9, 26, 0, 20, 9.359375f, 0.000000f, 0.812500f, 0.359375f, 0.847656f, 0.460938f, 96, 0},
+  {L'|', 3, 26, 2, 20, 7.281250f, 0.000000f, 0.089844f, 0.332031f, 0.101562f, 0.433594f, 96, 0},
+  {L'}', 9, 26, 0, 20, 9.359375f, 0.000000f, 0.171875f, 0.398438f, 0.207031f, 0.500000f, 96, 0},
+  {L'~', 15, 6, 1, 13, 16.359375f, 0.000000f, 0.105469f, 0.402344f, 0.164062f, 0.425781f, 96, 0},
+};
+
+const texture_font_t* arial_28pt() {
+    // Only the glyph lookup tables are built, the first time the font is used
+    static const texture_font_t font = texture_font_create(256, 256, 1, tex_data, 28.000000f, 32.200001f, 0.910000f, 25.350000f, -5.940000f, 96, glyphs, kerning);
+    return &font;
+}
@@ -44,9 +44,10 @@
 
 #include "glex/fonts/arial_32pt.h"
 
-texture_font_t arial_32pt = {
- 256, 256, 1, 
- {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// The font data is constexpr so it lives in read-only memory and costs nothing until the font is used
+
+static constexpr unsigned char tex_data[256 * 256 * 1] = {
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -2093,104 +2094,209 @@ texture_font_t arial_32pt = {
   0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 
- 32.000000f, 36.799999f, 1.040000f, 28.969999f, -6.790000f, 96, 
- {
-  {L'\0', 0, 0, 0, 0, 0.000000f, 0.000000f, 0.011719f, 0.011719f, 0.015625f, 0.015625f, 0, { } },
-  {L' ', 0, 0, 0, 0, 8.890625f, 0.000000f, 0.023438f, 0.003906f, 0.023438f, 0.003906f, 5, { {L'A', -1.765625f}, {L'L', -1.187500f}, {L'P', -0.578125f}, {L'T', -0.578125f}, {L'Y', -0.578125f}} },
-  {L'!', 5, 23, 2, 23, 8.890625f, 0.000000f, 0.027344f, 0.003906f, 0.046875f, 0.093750f, 0, { } },
-  {L'"', 9, 8, 1, 23, 11.359375f, 0.000000f, 0.050781f, 0.003906f, 0.085938f, 0.035156f, 0, { } },
-  {L'#', 18, 23, 0, 23, 17.796875f, 0.000000f, 0.089844f, 0.003906f, 0.160156f, 0.093750f, 0, { } },
-  {L'$', 16, 29, 1, 26, 17.796875f, 0.000000f, 0.164062f, 0.003906f, 0.226562f, 0.117188f, 0, { } },
-  {L'%', 26, 23, 1, 23, 28.453125f, 0.000000f, 0.230469f, 0.003906f, 0.332031f, 0.093750f, 0, { } },
-  {L'&', 20, 24, 1, 23, 21.343750f, 0.000000f, 0.335938f, 0.003906f, 0.414062f, 0.097656f, 0, { } },
-  {L'\'', 4, 8, 1, 23, 6.109375f, 0.000000f, 0.417969f, 0.003906f, 0.433594f, 0.035156f, 0, { } },
-  {L'(', 9, 29, 1, 23, 10.656250f, 0.000000f, 0.437500f, 0.003906f, 0.472656f, 0.117188f, 0, { } },
-  {L')', 9, 29, 1, 23, 10.656250f, 0.000000f, 0.476562f, 0.003906f, 0.511719f, 0.117188f, 0, { } },
-  {L'*', 11, 10, 1, 23, 12.453125f, 0.000000f, 0.515625f, 0.003906f, 0.558594f, 0.042969f, 0, { } },
-  {L'+', 16, 15, 1, 19, 18.687500f, 0.000000f, 0.562500f, 0.003906f, 0.625000f, 0.062500f, 0, { } },
-  {L',', 5, 8, 2, 3, 8.890625f, 0.000000f, 0.628906f, 0.003906f, 0.648438f, 0.035156f, 10, { {L'F', -3.546875f}, {L'P', -4.125000f}, {L'T', -3.546875f}, {L'V', -2.937500f}, {L'W', -1.765625f}, {L'Y', -4.125000f}, {L'r', -1.765625f}, {L'v', -2.375000f}, {L'w', -1.765625f}, {L'y', -2.375000f}} },
-  {L'-', 9, 3, 1, 10, 10.656250f, 0.000000f, 0.652344f, 0.003906f, 0.687500f, 0.015625f, 4, { {L'T', -1.765625f}, {L'V', -1.765625f}, {L'W', -0.578125f}, {L'Y', -2.937500f}} },
-  {L'.', 5, 3, 2, 3, 8.890625f, 0.000000f, 0.691406f, 0.003906f, 0.710938f, 0.015625f, 10, { {L'F', -3.546875f}, {L'P', -4.125000f}, {L'T', -3.546875f}, {L'V', -2.937500f}, {L'W', -1.765625f}, {L'Y', -4.125000f}, {L'r', -1.765625f}, {L'v', -2.375000f}, {L'w', -1.765625f}, {L'y', -2.375000f}} },
-  {L'/', 9, 23, 0, 23, 8.890625f, 0.000000f, 0.714844f, 0.003906f, 0.750000f, 0.093750f, 0, { } },
-  {L'0', 16, 23, 1, 23, 17.796875f, 0.000000f, 0.753906f, 0.003906f, 0.816406f, 0.093750f, 0, { } },
-  {L'1', 9, 23, 3, 23, 17.796875f, 0.000000f, 0.820312f, 0.003906f, 0.855469f, 0.093750f, 1, { {L'1', -2.375000f}} },
-  {L'2', 17, 23, 0, 23, 17.796875f, 0.000000f, 0.859375f, 0.003906f, 0.925781f, 0.093750f, 0, { } },
-  {L'3', 16, 23, 1, 23, 17.796875f, 0.000000f, 0.929688f, 0.003906f, 0.992188f, 0.093750f, 0, { } },
-  {L'4', 17, 23, 0, 23, 17.796875f, 0.000000f, 0.628906f, 0.039062f, 0.695312f, 0.128906f, 0, { } },
-  {L'5', 16, 23, 1, 23, 17.796875f, 0.000000f, 0.515625f, 0.066406f, 0.578125f, 0.156250f, 0, { } },
-  {L'6', 16, 23, 1, 23, 17.796875f, 0.000000f, 0.023438f, 0.097656f, 0.085938f, 0.187500f, 0, { } },
-  {L'7', 16, 23, 1, 23, 17.796875f, 0.000000f, 0.699219f, 0.097656f, 0.761719f, 0.187500f, 0, { } },
-  {L'8', 16, 23, 1, 23, 17.796875f, 0.000000f, 0.089844f, 0.097656f, 0.152344f, 0.187500f, 0, { } },
-  {L'9', 16, 23, 1, 23, 17.796875f, 0.000000f, 0.230469f, 0.097656f, 0.292969f, 0.187500f, 0, { } },
-  {L':', 5, 17, 2, 17, 8.890625f, 0.000000f, 0.582031f, 0.066406f, 0.601562f, 0.132812f, 4, { {L'T', -3.546875f}, {L'V', -1.187500f}, {L'W', -0.578125f}, {L'Y', -1.765625f}} },
-  {L';', 5, 22, 2, 17, 8.890625f, 0.000000f, 0.605469f, 0.066406f, 0.625000f, 0.152344f, 4, { {L'T', -3.546875f}, {L'V', -1.187500f}, {L'W', -0.578125f}, {L'Y', -2.078125f}} },
-  {L'<', 16, 17, 1, 20, 18.687500f, 0.000000f, 0.765625f, 0.097656f, 0.828125f, 0.164062f, 0, { } },
-  {L'=', 16, 10, 1, 17, 18.687500f, 0.000000f, 0.832031f, 0.097656f, 0.894531f, 0.136719f, 0, { } },
-  {L'>', 16, 17, 1, 20, 18.687500f, 0.000000f, 0.898438f, 0.097656f, 0.960938f, 0.164062f, 0, { } },
-  {L'?', 16, 23, 1, 23, 17.796875f, 0.000000f, 0.296875f, 0.101562f, 0.359375f, 0.191406f, 0, { } },
-  {L'@', 31, 29, 1, 23, 32.484375f, 0.000000f, 0.363281f, 0.121094f, 0.484375f, 0.234375f, 0, { } },
-  {L'A', 23, 23, -1, 23, 21.343750f, 0.000000f, 0.582031f, 0.156250f, 0.671875f, 0.246094f, 7, { {L' ', -1.765625f}, {L'F', -1.765625f}, {L'P', -2.375000f}, {L'T', -2.375000f}, {L'V', -2.375000f}, {L'W', -1.187500f}, {L'Y', -2.375000f}} },
-  {L'B', 18, 23, 2, 23, 21.343750f, 0.000000f, 0.156250f, 0.121094f, 0.226562f, 0.210938f, 0, { } },
-  {L'C', 21, 23, 1, 23, 23.109375f, 0.000000f, 0.488281f, 0.160156f, 0.570312f, 0.250000f, 0, { } },
-  {L'D', 20, 23, 2, 23, 23.109375f, 0.000000f, 0.765625f, 0.167969f, 0.843750f, 0.257812f, 0, { } },
-  {L'E', 18, 23, 2, 23, 21.343750f, 0.000000f, 0.847656f, 0.167969f, 0.917969f, 0.257812f, 0, { } },
-  {L'F', 17, 23, 2, 23, 19.546875f, 0.000000f, 0.921875f, 0.167969f, 0.988281f, 0.257812f, 0, { } },
-  {L'G', 22, 23, 1, 23, 24.890625f, 0.000000f, 0.003906f, 0.191406f, 0.089844f, 0.281250f, 0, { } },
-  {L'H', 19, 23, 2, 23, 23.109375f, 0.000000f, 0.675781f, 0.191406f, 0.750000f, 0.281250f, 0, { } },
-  {L'I', 5, 23, 2, 23, 8.890625f, 0.000000f, 0.093750f, 0.191406f, 0.113281f, 0.281250f, 0, { } },
-  {L'J', 14, 23, 0, 23, 16.000000f, 0.000000f, 0.230469f, 0.191406f, 0.285156f, 0.281250f, 0, { } },
-  {L'K', 20, 23, 2, 23, 21.343750f, 0.000000f, 0.117188f, 0.214844f, 0.195312f, 0.304688f, 0, { } },
-  {L'L', 15, 23, 2, 23, 17.796875f, 0.000000f, 0.289062f, 0.195312f, 0.347656f, 0.285156f, 0, { } },
-  {L'M', 23, 23, 2, 23, 26.656250f, 0.000000f, 0.351562f, 0.238281f, 0.441406f, 0.328125f, 0, { } },
-  {L'N', 19, 23, 2, 23, 23.109375f, 0.000000f, 0.574219f, 0.250000f, 0.648438f, 0.339844f, 0, { } },
-  {L'O', 23, 23, 1, 23, 24.890625f, 0.000000f, 0.445312f, 0.253906f, 0.535156f, 0.343750f, 1, { {L'T', -0.578125f}} },
-  {L'P', 18, 23, 2, 23, 21.343750f, 0.000000f, 0.753906f, 0.261719f, 0.824219f, 0.351562f, 0, { } },
-  {L'Q', 23, 25, 1, 23, 24.890625f, 0.000000f, 0.828125f, 0.261719f, 0.917969f, 0.359375f, 0, { } },
-  {L'R', 21, 23, 2, 23, 23.109375f, 0.000000f, 0.652344f, 0.285156f, 0.734375f, 0.375000f, 0, { } },
-  {L'S', 19, 23, 1, 23, 21.343750f, 0.000000f, 0.199219f, 0.285156f, 0.273438f, 0.375000f, 0, { } },
-  {L'T', 19, 23, 0, 23, 19.546875f, 0.000000f, 0.003906f, 0.285156f, 0.078125f, 0.375000f, 4, { {L' ', -0.578125f}, {L'A', -2.375000f}, {L'L', -2.375000f}, {L'R', -0.578125f}} },
-  {L'U', 19, 23, 2, 23, 23.109375f, 0.000000f, 0.082031f, 0.308594f, 0.156250f, 0.398438f, 0, { } },
-  {L'V', 22, 23, 0, 23, 21.343750f, 0.000000f, 0.277344f, 0.332031f, 0.363281f, 0.421875f, 3, { {L'A', -2.375000f}, {L'L', -2.375000f}, {L'R', -0.578125f}} },
-  {L'W', 30, 23, 0, 23, 30.203125f, 0.000000f, 0.367188f, 0.347656f, 0.484375f, 0.437500f, 3, { {L'A', -1.187500f}, {L'L', -2.375000f}, {L'R', -0.578125f}} },
-  {L'X', 22, 23, 0, 23, 21.343750f, 0.000000f, 0.539062f, 0.343750f, 0.625000f, 0.433594f, 0, { } },
-  {L'Y', 22, 23, 0, 23, 21.343750f, 0.000000f, 0.738281f, 0.355469f, 0.824219f, 0.445312f, 4, { {L' ', -0.578125f}, {L'A', -2.375000f}, {L'L', -2.375000f}, {L'R', -0.578125f}} },
-  {L'Z', 19, 23, 0, 23, 19.546875f, 0.000000f, 0.828125f, 0.363281f, 0.902344f, 0.453125f, 0, { } },
-  {L'[', 7, 29, 2, 23, 8.890625f, 0.000000f, 0.921875f, 0.261719f, 0.949219f, 0.375000f, 0, { } },
-  {L'\\', 9, 23, 0, 23, 8.890625f, 0.000000f, 0.953125f, 0.261719f, 0.988281f, 0.351562f, 0, { } },
-  {L']', 7, 29, 0, 23, 8.890625f, 0.000000f, 0.160156f, 0.308594f, 0.187500f, 0.421875f, 0, { } },
-  {L'^', 15, 13, 0, 24, 15.015625f, 0.000000f, 0.191406f, 0.378906f, 0.250000f, 0.429688f, 0, { } },
-  {L'_', 20, 3, -1, -3, 17.796875f, 0.000000f, 0.906250f, 0.378906f, 0.984375f, 0.390625f, 0, { } },
-  {L'`', 7, 4, 1, 23, 10.656250f, 0.000000f, 0.488281f, 0.347656f, 0.515625f, 0.363281f, 0, { } },
-  {L'a', 16, 17, 1, 17, 17.796875f, 0.000000f, 0.628906f, 0.378906f, 0.691406f, 0.445312f, 4, { {L'T', -3.546875f}, {L'V', -2.375000f}, {L'W', -1.187500f}, {L'Y', -2.375000f}} },
-  {L'b', 15, 23, 2, 23, 17.796875f, 0.000000f, 0.003906f, 0.378906f, 0.062500f, 0.468750f, 0, { } },
-  {L'c', 15, 17, 1, 17, 16.000000f, 0.000000f, 0.906250f, 0.394531f, 0.964844f, 0.460938f, 1, { {L'T', -3.546875f}} },
-  {L'd', 15, 23, 1, 23, 17.796875f, 0.000000f, 0.066406f, 0.402344f, 0.125000f, 0.492188f, 0, { } },
-  {L'e', 16, 17, 1, 17, 17.796875f, 0.000000f, 0.253906f, 0.425781f, 0.316406f, 0.492188f, 4, { {L'T', -3.546875f}, {L'V', -1.765625f}, {L'W', -0.578125f}, {L'Y', -2.937500f}} },
-  {L'f', 10, 23, 0, 23, 8.890625f, 0.000000f, 0.488281f, 0.367188f, 0.527344f, 0.457031f, 1, { {L'f', -0.578125f}} },
-  {L'g', 15, 23, 1, 17, 17.796875f, 0.000000f, 0.128906f, 0.425781f, 0.187500f, 0.515625f, 0, { } },
-  {L'h', 14, 23, 2, 23, 17.796875f, 0.000000f, 0.191406f, 0.433594f, 0.246094f, 0.523438f, 0, { } },
-  {L'i', 3, 23, 2, 23, 7.109375f, 0.000000f, 0.695312f, 0.378906f, 0.707031f, 0.468750f, 3, { {L'T', -1.187500f}, {L'V', -0.578125f}, {L'Y', -1.187500f}} },
-  {L'j', 7, 29, -2, 23, 7.109375f, 0.000000f, 0.320312f, 0.425781f, 0.347656f, 0.539062f, 0, { } },
-  {L'k', 14, 23, 2, 23, 16.000000f, 0.000000f, 0.531250f, 0.437500f, 0.585938f, 0.527344f, 0, { } },
-  {L'l', 3, 23, 2, 23, 7.109375f, 0.000000f, 0.710938f, 0.378906f, 0.722656f, 0.468750f, 0, { } },
-  {L'm', 23, 17, 2, 17, 26.656250f, 0.000000f, 0.351562f, 0.441406f, 0.441406f, 0.507812f, 0, { } },
-  {L'n', 14, 17, 2, 17, 17.796875f, 0.000000f, 0.726562f, 0.449219f, 0.781250f, 0.515625f, 0, { } },
-  {L'o', 16, 17, 1, 17, 17.796875f, 0.000000f, 0.589844f, 0.449219f, 0.652344f, 0.515625f, 4, { {L'T', -3.546875f}, {L'V', -1.765625f}, {L'W', -0.578125f}, {L'Y', -2.937500f}} },
-  {L'p', 15, 23, 2, 17, 17.796875f, 0.000000f, 0.785156f, 0.457031f, 0.843750f, 0.546875f, 1, { {L'Y', -2.375000f}} },
-  {L'q', 15, 23, 1, 17, 17.796875f, 0.000000f, 0.445312f, 0.460938f, 0.503906f, 0.550781f, 1, { {L'Y', -2.937500f}} },
-  {L'r', 10, 17, 2, 17, 10.656250f, 0.000000f, 0.847656f, 0.457031f, 0.886719f, 0.523438f, 3, { {L'T', -1.187500f}, {L'V', -1.187500f}, {L'W', -0.578125f}} },
-  {L's', 15, 17, 0, 17, 16.000000f, 0.000000f, 0.890625f, 0.464844f, 0.949219f, 0.531250f, 1, { {L'T', -3.546875f}} },
-  {L't', 9, 23, 0, 23, 8.890625f, 0.000000f, 0.656250f, 0.449219f, 0.691406f, 0.539062f, 0, { } },
-  {L'u', 14, 17, 2, 17, 17.796875f, 0.000000f, 0.003906f, 0.472656f, 0.058594f, 0.539062f, 4, { {L'T', -1.187500f}, {L'V', -1.187500f}, {L'W', -0.578125f}, {L'Y', -1.765625f}} },
-  {L'v', 16, 17, 0, 17, 16.000000f, 0.000000f, 0.062500f, 0.496094f, 0.125000f, 0.562500f, 2, { {L'A', -0.578125f}, {L'Y', -1.765625f}} },
-  {L'w', 23, 17, 0, 17, 23.109375f, 0.000000f, 0.351562f, 0.511719f, 0.441406f, 0.578125f, 2, { {L'A', -0.578125f}, {L'T', -1.765625f}} },
-  {L'x', 16, 17, 0, 17, 16.000000f, 0.000000f, 0.250000f, 0.496094f, 0.312500f, 0.562500f, 0, { } },
-  {L'y', 16, 23, 0, 17, 16.000000f, 0.000000f, 0.695312f, 0.519531f, 0.757812f, 0.609375f, 5, { {L'A', -0.578125f}, {L'L', -1.187500f}, {L'T', -1.765625f}, {L'V', -1.187500f}, {L'W', -0.281250f}} },
-  {L'z', 16, 17, 0, 17, 16.000000f, 0.000000f, 0.589844f, 0.519531f, 0.652344f, 0.585938f, 0, { } },
-  {L'{', 10, 29, 0, 23, 10.687500f, 0.000000f, 0.953125f, 0.464844f, 0.992188f, 0.578125f, 0, { } },
-  {L'|', 4, 29, 2, 23, 8.312500f, 0.000000f, 0.507812f, 0.460938f, 0.523438f, 0.574219f, 0, { } },
-  {L'}', 10, 29, 0, 23, 10.687500f, 0.000000f, 0.128906f, 0.519531f, 0.167969f, 0.632812f, 0, { } },
-  {L'~', 17, 7, 1, 15, 18.687500f, 0.000000f, 0.171875f, 0.527344f, 0.238281f, 0.554688f, 0, { } },
- }
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+static constexpr kerning_t kerning[96] = {
+  {L'A', -1.765625f},
+  {L'L', -1.187500f},
+  {L'P', -0.578125f},
+  {L'T', -0.578125f},
+  {L'Y', -0.578125f},
+  {L'F', -3.546875f},
+  {L'P', -4.125000f},
+  {L'T', -3.546875f},
+  {L'V', -2.937500f},
+  {L'W', -1.765625f},
+  {L'Y', -4.125000f},
+  {L'r', -1.765625f},
+  {L'v', -2.375000f},
+  {L'w', -1.765625f},
+  {L'y', -2.375000f},
+  {L'T', -1.765625f},
+  {L'V', -1.765625f},
+  {L'W', -0.578125f},
+  {L'Y', -2.937500f},
+  {L'F', -3.546875f},
+  {L'P', -4.125000f},
+  {L'T', -3.546875f},
+  {L'V', -2.937500f},
+  {L'W', -1.765625f},
+  {L'Y', -4.125000f},
+  {L'r', -1.765625f},
+  {L'v', -2.375000f},
+  {L'w', -1.765625f},
+  {L'y', -2.375000f},
+  {L'1', -2.375000f},
+  {L'T', -3.546875f},
+  {L'V', -1.187500f},
+  {L'W', -0.578125f},
+  {L'Y', -1.765625f},
+  {L'T', -3.546875f},
+  {L'V', -1.187500f},
+  {L'W', -0.578125f},
+  {L'Y', -2.078125f},
+  {L' ', -1.765625f},
+  {L'F', -1.765625f},
+  {L'P', -2.375000f},
+  {L'T', -2.375000f},
+  {L'V', -2.375000f},
+  {L'W', -1.187500f},
+  {L'Y', -2.375000f},
+  {L'T', -0.578125f},
+  {L' ', -0.578125f},
+  {L'A', -2.375000f},
+  {L'L', -2.375000f},
+  {L'R', -0.578125f},
+  {L'A', -2.375000f},
+  {L'L', -2.375000f},
+  {L'R', -0.578125f},
+  {L'A', -1.187500f},
+  {L'L', -2.375000f},
+  {L'R', -0.578125f},
+  {L' ', -0.578125f},
+  {L'A', -2.375000f},
+  {L'L', -2.375000f},
+  {L'R', -0.578125f},
+  {L'T', -3.546875f},
+  {L'V', -2.375000f},
+  {L'W', -1.187500f},
+  {L'Y', -2.375000f},
+  {L'T', -3.546875f},
+  {L'T', -3.546875f},
+  {L'V', -1.765625f},
+  {L'W', -0.578125f},
+  {L'Y', -2.937500f},
+  {L'f', -0.578125f},
+  {L'T', -1.187500f},
+  {L'V', -0.578125f},
+  {L'Y', -1.187500f},
+  {L'T', -3.546875f},
+  {L'V', -1.765625f},
+  {L'W', -0.578125f},
+  {L'Y', -2.937500f},
+  {L'Y', -2.375000f},
+  {L'Y', -2.937500f},
+  {L'T', -1.187500f},
+  {L'V', -1.187500f},
+  {L'W', -0.578125f},
+  {L'T', -3.546875f},
+  {L'T', -1.187500f},
+  {L'V', -1.187500f},
+  {L'W', -0.578125f},
+  {L'Y', -1.765625f},
+  {L'A', -0.578125f},
+  {L'Y', -1.765625f},
+  {L'A', -0.578125f},
+  {L'T', -1.765625f},
+  {L'A', -0.578125f},
+  {L'L', -1.187500f},
+  {L'T', -1.765625f},
+  {L'V', -1.187500f},
+  {L'W', -0.281250f},
 };
+
+static constexpr texture_glyph_t glyphs[96] = {
+  {L'\0', 0, 0, 0, 0, 0.000000f, 0.000000f, 0.011719f, 0.011719f, 0.015625f, 0.015625f, 0, 0},
+  {L' ', 0, 0, 0, 0, 8.890625f, 0.000000f, 0.023438f, 0.003906f, 0.023438f, 0.003906f, 0, 5},
+  {L'!', 5, 23, 2, 23, 8.890625f, 0.000000f, 0.027344f, 0.003906f, 0.046875f, 0.093750f, 5, 0},
+  {L'"', 9, 8, 1, 23, 11.359375f, 0.000000f, 0.050781f, 0.003906f, 0.085938f, 0.035156f, 5, 0},
+  {L'#', 18, 23, 0, 23, 17.796875f, 0.000000f, 0.089844f, 0.003906f, 0.160156f, 0.093750f, 5, 0},
+  {L'$', 16, 29, 1, 26, 17.796875f, 0.000000f, 0.164062f, 0.003906f, 0.226562f, 0.117188f, 5, 0},
+  {L'%', 26, 23, 1, 23, 28.453125f, 0.000000f, 0.230469f, 0.003906f, 0.332031f, 0.093750f, 5, 0},
+  {L'&', 20, 24, 1, 23, 21.343750f, 0.000000f, 0.335938f, 0.003906f, 0.414062f, 0.097656f, 5, 0},
+  {L'\'', 4, 8, 1, 23, 6.109375f, 0.000000f, 0.417969f, 0.003906f, 0.433594f, 0.035156f, 5, 0},
+  {L'(', 9, 29, 1, 23, 10.656250f, 0.000000f, 0.437500f, 0.003906f, 0.472656f, 0.117188f, 5, 0},
+  {L')', 9, 29, 1, 23, 10.656250f, 0.000000f, 0.476562f, 0.003906f, 0.511719f, 0.117188f, 5, 0},
+  {L'*', 11, 10, 1, 23, 12.453125f, 0.000000f, 0.515625f, 0.003906f, 0.558594f, 0.042969f, 5, 0},
+  {L'+', 16, 15, 1, 19, 18.687500f, 0.000000f, 0.562500f, 0.003906f, 0.625000f, 0.062500f, 5, 0},
+  {L',', 5, 8, 2, 3, 8.890625f, 0.000000f, 0.628906f, 0.003906f, 0.648438f, 0.035156f, 5, 10},
+  {L'-', 9, 3, 1, 10, 10.656250f, 0.000000f, 0.652344f, 0.003906f, 0.687500f, 0.015625f, 15, 4},
+  {L'.', 5, 3, 2, 3, 8.890625f, 0.000000f, 0.691406f, 0.003906f, 0.710938f, 0.015625f, 19, 10},
+  {L'/', 9, 23, 0, 23, 8.890625f, 0.000000f, 0.714844f, 0.003906f, 0.750000f, 0.093750f, 29, 0},
+  {L'0', 16, 23, 1, 23, 17.796875f, 0.000000f, 0.753906f, 0.003906f, 0.816406f, 0.093750f, 29, 0},
+  {L'1', 9, 23, 3, 23, 17.796875f, 0.000000f, 0.820312f, 0.003906f, 0.855469f, 0.093750f, 29, 1},
+  {L'2', 17, 23, 0, 23, 17.796875f, 0.000000f, 0.859375f, 0.003906f, 0.925781f, 0.093750f, 30, 0},
+  {L'3', 16, 23, 1, 23, 17.796875f, 0.000000f, 0.929688f, 0.003906f, 0.992188f, 0.093750f, 30, 0},
+  {L'4', 17, 23, 0, 23, 17.796875f, 0.000000f, 0.628906f, 0.039062f, 0.695312f, 0.128906f, 30, 0},
+  {L'5', 16, 23, 1, 23, 17.796875f, 0.000000f, 0.515625f, 0.066406f, 0.578125f, 0.156250f, 30, 0},
+  {L'6', 16, 23, 1, 23, 17.796875f, 0.000000f, 0.023438f, 0.097656f, 0.085938f, 0.187500f, 30, 0},
+  {L'7', 16, 23, 1, 23, 17.796875f, 0.000000f, 0.699219f, 0.097656f, 0.761719f, 0.187500f, 30, 0},
+  {L'8', 16, 23, 1, 23, 17.796875f, 0.000000f, 0.089844f, 0.097656f, 0.152344f, 0.187500f, 30, 0},
+  {L'9', 16, 23, 1, 23, 17.796875f, 0.000000f, 0.230469f, 0.097656f, 0.292969f, 0.187500f, 30, 0},
+  {L':', 5, 17, 2, 17, 8.890625f, 0.000000f, 0.582031f, 0.066406f, 0.601562f, 0.132812f, 30, 4},
+  {L';', 5, 22, 2, 17, 8.890625f, 0.000000f, 0.605469f, 0.066406f, 0.625000f, 0.152344f, 34, 4},
+  {L'<', 16, 17, 1, 20, 18.687500f, 0.000000f, 0.765625f, 0.097656f, 0.828125f, 0.164062f, 38, 0},
+  {L'=', 16, 10, 1, 17, 18.687500f, 0.000000f, 0.832031f, 0.097656f, 0.894531f, 0.136719f, 38, 0},
+  {L'>', 16, 17, 1, 20, 18.687500f, 0.000000f, 0.898438f, 0.097656f, 0.960938f, 0.164062f, 38, 0},
+  {L'?', 16, 23, 1, 23, 17.796875f, 0.000000f, 0.296875f, 0.101562f, 0.359375f, 0.191406f, 38, 0},
+  {L'@', 31, 29, 1, 23, 32.484375f, 0.000000f, 0.363281f, 0.121094f, 0.484375f, 0.234375f, 38, 0},
+  {L'A', 23, 23, -1, 23, 21.343750f, 0.000000f, 0.582031f, 0.156250f, 0.671875f, 0.246094f, 38, 7},
+  {L'B', 18, 23, 2, 23, 21.343750f, 0.000000f, 0.156250f, 0.121094f, 0.226562f, 0.210938f, 45, 0},
+  {L'C', 21, 23, 1, 23, 23.109375f, 0.000000f, 0.488281f, 0.160156f, 0.570312f, 0.250000f, 45, 0},
+  {L'D', 20, 23, 2, 23, 23.109375f, 0.000000f, 0.765625f, 0.167969f, 0.843750f, 0.257812f, 45, 0},
+  {L'E', 18, 23, 2, 23, 21.343750f, 0.000000f, 0.847656f, 0.167969f, 0.917969f, 0.257812f, 45, 0},
+  {L'F', 17, 23, 2, 23, 19.546875f, 0.000000f, 0.921875f, 0.167969f, 0.988281f, 0.257812f, 45, 0},
+  {L'G', 22, 23, 1, 23, 24.890625f, 0.000000f, 0.003906f, 0.191406f, 0.089844f, 0.281250f, 45, 0},
+  {L'H', 19, 23, 2, 23, 23.109375f, 0.000000f, 0.675781f, 0.191406f, 0.750000f, 0.281250f, 45, 0},
+  {L'I', 5, 23, 2, 23, 8.890625f, 0.000000f, 0.093750f, 0.191406f, 0.113281f, 0.281250f, 45, 0},
+  {L'J', 14, 23, 0, 23, 16.000000f, 0.000000f, 0.230469f, 0.191406f, 0.285156f, 0.281250f, 45, 0},
+  {L'K', 20, 23, 2, 23, 21.343750f, 0.000000f, 0.117188f, 0.214844f, 0.195312f, 0.304688f, 45, 0},
+  {L'L', 15, 23, 2, 23, 17.796875f, 0.000000f, 0.289062f, 0.195312f, 0.347656f, 0.285156f, 45, 0},
+  {L'M', 23, 23, 2, 23, 26.656250f, 0.000000f, 0.351562f, 0.238281f, 0.441406f, 0.328125f, 45, 0},
+  {L'N', 19, 23, 2, 23, 23.109375f, 0.000000f, 0.574219f, 0.250000f, 0.648438f, 0.339844f, 45, 0},
+  {L'O', 23, 23, 1, 23, 24.890625f, 0.000000f, 0.445312f, 0.253906f, 0.535156f, 0.343750f, 45, 1},
+  {L'P', 18, 23, 2, 23, 21.343750f, 0.000000f, 0.753906f, 0.261719f, 0.824219f, 0.351562f, 46, 0},
+  {L'Q', 23, 25, 1, 23, 24.890625f, 0.000000f, 0.828125f, 0.261719f, 0.917969f, 0.359375f, 46, 0},
+  {L'R', 21, 23, 2, 23, 23.109375f, 0.000000f, 0.652344f, 0.285156f, 0.734375f, 0.375000f, 46, 0},
+  {L'S', 19, 23, 1, 23, 21.343750f, 0.000000f, 0.199219f, 0.285156f, 0.273438f, 0.375000f, 46, 0},
+  {L'T', 19, 23, 0, 23, 19.546875f, 0.000000f, 0.003906f, 0.285156f, 0.078125f, 0.375000f, 46, 4},
+  {L'U', 19, 23, 2, 23, 23.109375f, 0.000000f, 0.082031f, 0.308594f, 0.156250f, 0.398438f, 50, 0},
+  {L'V', 22, 23, 0, 23, 21.343750f, 0.000000f, 0.277344f, 0.332031f, 0.363281f, 0.421875f, 50, 3},
+  {L'W', 30, 23, 0, 23, 30.203125f, 0.000000f, 0.367188f, 0.347656f, 0.484375f, 0.437500f, 53, 3},
+  {L'X', 22, 23, 0, 23, 21.343750f, 0.000000f, 0.539062f, 0.343750f, 0.625000f, 0.433594f, 56, 0},
+  {L'Y', 22, 23, 0, 23, 21.343750f, 0.000000f, 0.738281f, 0.355469f, 0.824219f, 0.445312f, 56, 4},
+  {L'Z', 19, 23, 0, 23, 19.546875f, 0.000000f, 0.828125f, 0.363281f, 0.902344f, 0.453125f, 60, 0},
+  {L'[', 7, 29, 2, 23, 8.890625f, 0.000000f, 0.921875f, 0.261719f, 0.949219f, 0.375000f, 60, 0},
+  {L'\\', 9, 23, 0, 23, 8.890625f, 0.000000f, 0.953125f, 0.261719f, 0.988281f, 0.351562f, 60, 0},
+  {L']', 7, 29, 0, 23, 8.890625f, 0.000000f, 0.160156f, 0.308594f, 0.187500f, 0.421875f, 60, 0},
+  {L'^', 15, 13, 0, 24, 15.015625f, 0.000000f, 0.191406f, 0.378906f, 0.250000f, 0.429688f, 60, 0},
+  {L'_', 20, 3, -1, -3, 17.796875f, 0.000000f, 0.906250f, 0.378906f, 0.984375f, 0.390625f, 60, 0},
+  {L'`', 7, 4, 1, 23, 10.656250f, 0.000000f, 0.488281f, 0.347656f, 0.515625f, 0.363281f, 60, 0},
+  {L'a', 16, 17, 1, 17, 17.796875f, 0.000000f, 0.628906f, 0.378906f, 0.691406f, 0.445312f, 60, 4},
+  {L'b', 15, 23, 2, 23, 17.796875f, 0.000000f, 0.003906f, 0.378906f, 0.062500f, 0.468750f, 64, 0},
+  {L'c', 15, 17, 1, 17, 16.000000f, 0.000000f, 0.906250f, 0.394531f, 0.964844f, 0.460938f, 64, 1},
+  {L'd', 15, 23, 1, 23, 17.796875f, 0.000000f, 0.066406f, 0.402344f, 0.125000f, 0.492188f, 65, 0},
+  {L'e', 16, 17, 1, 17, 17.796875f, 0.000000f, 0.253906f, 0.425781f, 0.316406f, 0.492188f, 65, 4},
+  {L'f', 10, 23, 0, 23, 8.890625f, 0.000000f, 0.488281f, 0.367188f, 0.527344f, 0.457031f, 69, 1},
+  {L'g', 15, 23, 1, 17, 17.796875f, 0.000000f, 0.128906f, 0.425781f, 0.187500f, 0.515625f, 70, 0},
+  {L'h', 14, 23, 2, 23, 17.796875f, 0.000000f, 0.191406f, 0.433594f, 0.246094f, 0.523438f, 70, 0},
+  {L'i', 3, 23, 2, 23, 7.109375f, 0.000000f, 0.695312f, 0.378906f, 0.707031f, 0.468750f, 70, 3},
+  {L'j', 7, 29, -2, 23, 7.109375f, 0.000000f, 0.320312f, 0.425781f, 0.347656f, 0.539062f, 73, 0},
+  {L'k', 14, 23, 2, 23, 16.000000f, 0.000000f, 0.531250f, 0.437500f, 0.585938f, 0.527344f, 73, 0},
+  {L'l', 3, 23, 2, 23, 7.109375f, 0.000000f, 0.710938f, 0.378906f, 0.722656f, 0.468750f, 73, 0},
+  {L'm', 23, 17, 2, 17, 26.656250f, 0.000000f, 0.351562f, 0.441406f, 0.441406f, 0.507812f, 73, 0},
+  {L'n', 14, 17, 2, 17, 17.796875f, 0.000000f, 0.726562f, 0.449219f, 0.781250f, 0.515625f, 73, 0},
+  {L'o', 16, 17, 1, 17, 17.796875f, 0.000000f, 0.589844f, 0.449219f, 0.652344f, 0.515625f, 73, 4},
+  {L'p', 15, 23, 2, 17, 17.796875f, 0.000000f, 0.785156f, 0.457031f, 0.843750f, 0.546875f, 77, 1},
+  {L'q', 15, 23, 1, 17, 17.796875f, 0.000000f, 0.445312f, 0.460938f, 0.503906f, 0.550781f, 78, 1},
+  {L'r', 10, 17, 2, 17, 10.656250f, 0.000000f, 0.847656f, 0.457031f, 0.886719f, 0.523438f, 79, 3},
+  {L's', 15, 17, 0, 17, 16.000000f, 0.000000f, 0.890625f, 0.464844f, 0.949219f, 0.531250f, 82, 1},
+  {L't', 9, 23, 0, 23, 8.890625f, 0.000000f, 0.656250f, 0.449219f, 0.691406f, 0.539062f, 83, 0},
+  {L'u', 14, 17, 2, 17, 17.796875f, 0.000000f, 0.003906f, 0.472656f, 0.058594f, 0.539062f, 83, 4},
+  {L'v', 16, 17, 0, 17, 16.000000f, 0.000000f, 0.062500f, 0.496094f, 0.125000f, 0.562500f, 87, 2},
+  {L'w', 23, 17, 0, 17, 23.109375f, 0.000000f, 0.351562f, 0.511719f, 0.441406f, 0.578125f, 89, 2},
+  {L'x', 16, 17, 0, 17, 16.000000f, 0.000000f, 0.250000f, 0.496094f, 0.312500f, 0.562500f, 91, 0},
+  {L'y', 16, 23, 0, 17, 16.000000f, 0.000000f, 0.695312f, 0.519531f, 0.757812f, 0.609375f, 91, 5},
+  {L'z', 16, 17, 0, 17, 16.000000f, 0.000000f, 0.589844f, 0.519531f, 0.652344f, 0.585938f, 96, 0},
+  {L'{', 10, 29, 0, 23, 10.687500f, 0.000000f, 0.953125f, 0.464844f, 0.992188f, 0.578125f, 96, 0},
+  {L'|', 4, 29, 2, 23, 8.312500f, 0.000000f, 0.507812f, 0.460938f, 0.523438f, 0.574219f, 96, 0},
+  {L'}', 10, 29, 0, 23, 10.687500f, 0.000000f, 0.128906f, 0.519531f, 0.167969f, 0.632812f, 96, 0},
+  {L'~', 17, 7, 1, 15, 18.687500f, 0.000000f, 0.171875f, 0.527344f, 0.238281f, 0.554688f, 96, 0},
+};
+
+const texture_font_t* arial_32pt() {
+    // Only the glyph lookup tables are built, the first time the font is used
+    static const texture_font_t font = texture_font_create(256, 256, 1, tex_data, 32.000000f, 36.799999f, 1.040000f, 28.969999f, -6.790000f, 96, glyphs, kerning);
+    return &font;
+}
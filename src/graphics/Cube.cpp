@@ -1,16 +1,111 @@
 #include "glex/graphics/Cube.h"
+#include "glex/graphics/RenderQueue.h"
+#include "glex/graphics/SceneNode.h"
+#include "glex/graphics/RenderBackend.h"
 #include "glex/common/log.h"
+#include "glex/math/Matrix.h"
+
+// Cube made of 6 quads (GL_QUADS is kept since GLdc submits a quad as 4 vertices, triangles would take 6)
+//    v7----- v4
+//   /|      /|
+//  v3------v0|
+//  | |     | |
+//  | |v6---|-|v5
+//  |/      |/
+//  v2------v1
+static constexpr GLfloat COLORED_VERTICES[24 * 6] = { // x, y, z, r, g, b
+    // Front face
+     1.0f,  1.0f,  1.0f,    1.0f,  0.0f,  0.0f,
+    -1.0f,  1.0f,  1.0f,    1.0f,  0.0f,  0.0f,
+    -1.0f, -1.0f,  1.0f,    1.0f,  0.0f,  0.0f,
+     1.0f, -1.0f,  1.0f,    1.0f,  0.0f,  0.0f,
+    // Top face
+     1.0f,  1.0f, -1.0f,    0.0f,  1.0f,  0.0f,
+    -1.0f,  1.0f, -1.0f,    0.0f,  1.0f,  0.0f,
+    -1.0f,  1.0f,  1.0f,    0.0f,  1.0f,  0.0f,
+     1.0f,  1.0f,  1.0f,    0.0f,  1.0f,  0.0f,
+    // Left face
+    -1.0f,  1.0f,  1.0f,    0.0f,  0.0f,  1.0f,
+    -1.0f,  1.0f, -1.0f,    0.0f,  0.0f,  1.0f,
+    -1.0f, -1.0f, -1.0f,    0.0f,  0.0f,  1.0f,
+    -1.0f, -1.0f,  1.0f,    0.0f,  0.0f,  1.0f,
+    // Back face
+     1.0f,  1.0f, -1.0f,    1.0f,  0.0f,  0.0f,
+    -1.0f,  1.0f, -1.0f,    1.0f,  0.0f,  0.0f,
+    -1.0f, -1.0f, -1.0f,    1.0f,  0.0f,  0.0f,
+     1.0f, -1.0f, -1.0f,    1.0f,  0.0f,  0.0f,
+    // Right face
+     1.0f,  1.0f, -1.0f,    0.0f,  0.0f,  1.0f,
+     1.0f,  1.0f,  1.0f,    0.0f,  0.0f,  1.0f,
+     1.0f, -1.0f,  1.0f,    0.0f,  0.0f,  1.0f,
+     1.0f, -1.0f, -1.0f,    0.0f,  0.0f,  1.0f,
+    // Bottom face
+     1.0f, -1.0f, -1.0f,    0.0f,  1.0f,  0.0f,
+    -1.0f, -1.0f, -1.0f,    0.0f,  1.0f,  0.0f,
+    -1.0f, -1.0f,  1.0f,    0.0f,  1.0f,  0.0f,
+     1.0f, -1.0f,  1.0f,    0.0f,  1.0f,  0.0f,
+};
+
+static constexpr GLfloat TEXTURED_VERTICES[24 * 5] = { // x, y, z, s, t
+    // Front face
+     1.0f,  1.0f,  1.0f,    0.0f,  0.0f,
+    -1.0f,  1.0f,  1.0f,    1.0f,  0.0f,
+    -1.0f, -1.0f,  1.0f,    1.0f,  1.0f,
+     1.0f, -1.0f,  1.0f,    0.0f,  1.0f,
+    // Top face
+     1.0f,  1.0f, -1.0f,    0.0f,  0.0f,
+    -1.0f,  1.0f, -1.0f,    1.0f,  0.0f,
+    -1.0f,  1.0f,  1.0f,    1.0f,  1.0f,
+     1.0f,  1.0f,  1.0f,    0.0f,  1.0f,
+    // Left face
+    -1.0f,  1.0f,  1.0f,    0.0f,  0.0f,
+    -1.0f,  1.0f, -1.0f,    1.0f,  0.0f,
+    -1.0f, -1.0f, -1.0f,    1.0f,  1.0f,
+    -1.0f, -1.0f,  1.0f,    0.0f,  1.0f,
+    // Back face
+     1.0f,  1.0f, -1.0f,    0.0f,  0.0f,
+    -1.0f,  1.0f, -1.0f,    1.0f,  0.0f,
+    -1.0f, -1.0f, -1.0f,    1.0f,  1.0f,
+     1.0f, -1.0f, -1.0f,    0.0f,  1.0f,
+    // Right face
+     1.0f,  1.0f, -1.0f,    0.0f,  0.0f,
+     1.0f,  1.0f,  1.0f,    1.0f,  0.0f,
+     1.0f, -1.0f,  1.0f,    1.0f,  1.0f,
+     1.0f, -1.0f, -1.0f,    0.0f,  1.0f,
+    // Bottom face
+     1.0f, -1.0f, -1.0f,    0.0f,  0.0f,
+     1.0f, -1.0f,  1.0f,    1.0f,  0.0f,
+    -1.0f, -1.0f,  1.0f,    1.0f,  1.0f,
+    -1.0f, -1.0f, -1.0f,    0.0f,  1.0f,
+};
 
 void Cube::draw() {
-    // Enable depth test
-    glEnable(GL_DEPTH_TEST);
-    // Accept fragment if it closer to the camera than the former one
-    glDepthFunc(GL_LESS);
+    _renderState().apply();
+    _drawTransformed();
+}
+
+void Cube::submit(RenderQueue& queue) {
+    queue.submit(_renderState(), 0.5, this, [](void* cube) {
+        static_cast<Cube*>(cube)->_drawTransformed();
+    });
+}
 
+RenderState Cube::_renderState() {
+    RenderState state;
+    state.textureId = texture != NULL ? texture->id : 0;
+    return state;
+}
+
+void Cube::_drawTransformed() {
     glPushMatrix();
-    glRotatef(_anglez, 0.0f, 0.0f, 1.0f);
-    glRotatef(_angley, 0.0f, 1.0f, 0.0f);
-    glRotatef(_anglex, 1.0f, 0.0f, 0.0f);
+    if (node != nullptr) {
+        glMultMatrixf(node->worldMatrix().data());
+        _drawList();
+        glPopMatrix();
+        return;
+    }
+
+    glMultMatrixf(Matrix4::rotationZYX(_anglex, _angley, _anglez).data());
     
     glScalef(3.0, 3.0, 3.0);
     
@@ -23,130 +118,23 @@ void Cube::draw() {
 }
 
 void Cube::_drawList() {
-    if (texture != NULL) {
-        // Enable texture
-        glEnable(GL_TEXTURE_2D);
-        glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-        glBindTexture(GL_TEXTURE_2D, texture->id);
+    // The vertices never change, so the backend compiles them once and replays them
+    Geometry& geometry = texture == NULL ? _colorGeometry : _textureGeometry;
+    if (geometry.vertices == nullptr) {
+        geometry.isStatic = true;
+        geometry.mode = GL_QUADS;
+        geometry.vertexCount = 24;
+        if (texture == NULL) {
+            geometry.vertices = COLORED_VERTICES;
+            geometry.layout.stride = (GLsizei)(6 * sizeof(GLfloat));
+            geometry.layout.colorOffset = (int)(3 * sizeof(GLfloat));
+        } else {
+            geometry.vertices = TEXTURED_VERTICES;
+            geometry.layout.stride = (GLsizei)(5 * sizeof(GLfloat));
+            geometry.layout.texCoordOffset = (int)(3 * sizeof(GLfloat));
+        }
     }
-    
-    // cube ///////////////////////////////////////////////////////////////////////
-    //    v7----- v4
-    //   /|      /|
-    //  v3------v0|
-    //  | |     | |
-    //  | |v6---|-|v5
-    //  |/      |/
-    //  v2------v1
-
-    GLfloat v0[3] = {  1.0f,  1.0f,  1.0f };
-    GLfloat v1[3] = {  1.0f, -1.0f,  1.0f };
-    GLfloat v2[3] = { -1.0f, -1.0f,  1.0f };
-    GLfloat v3[3] = { -1.0f,  1.0f,  1.0f };
-    GLfloat v4[3] = {  1.0f,  1.0f, -1.0f };
-    GLfloat v5[3] = {  1.0f, -1.0f, -1.0f };
-    GLfloat v6[3] = { -1.0f, -1.0f, -1.0f };
-    GLfloat v7[3] = { -1.0f,  1.0f, -1.0f };
-
-    glBegin(GL_QUADS);  // draw a cube with 6 quads
-
-    if (texture == NULL) {
-        glColor3f(1.0, 0.0, 0.0); 
-        glVertex3fv(v0);    // front face
-        glVertex3fv(v3);
-        glVertex3fv(v2);
-        glVertex3fv(v1);
-
-        glColor3f(0.0, 1.0, 0.0);
-        glVertex3fv(v4);    // top face
-        glVertex3fv(v7);
-        glVertex3fv(v3);
-        glVertex3fv(v0);
 
-        glColor3f(0.0, 0.0, 1.0);
-        glVertex3fv(v3);    // left face
-        glVertex3fv(v7);
-        glVertex3fv(v6);
-        glVertex3fv(v2);
-
-        glColor3f(1.0, 0.0, 0.0); 
-        glVertex3fv(v4);    // back face
-        glVertex3fv(v7);
-        glVertex3fv(v6);
-        glVertex3fv(v5);
-
-        glColor3f(0.0, 0.0, 1.0);
-        glVertex3fv(v4);    // right face
-        glVertex3fv(v0);
-        glVertex3fv(v1);
-        glVertex3fv(v5);
-
-        glColor3f(0.0, 1.0, 0.0);
-        glVertex3fv(v5);    // bottom face
-        glVertex3fv(v6);
-        glVertex3fv(v2);
-        glVertex3fv(v1);
-
-        glEnd();
-    } else {
-        glNormal3f(0, 0, 1); 
-
-        glColor3f(1.0, 1.0, 1.0); 
-        glTexCoord2f(0, 0);
-        glVertex3fv(v0);    // front face
-        glTexCoord2f(1, 0);
-        glVertex3fv(v3);
-        glTexCoord2f(1, 1);
-        glVertex3fv(v2);
-        glTexCoord2f(0, 1);
-        glVertex3fv(v1);
-
-        glTexCoord2f(0, 0);
-        glVertex3fv(v4);    // top face
-        glTexCoord2f(1, 0);
-        glVertex3fv(v7);
-        glTexCoord2f(1, 1);
-        glVertex3fv(v3);
-        glTexCoord2f(0, 1);
-        glVertex3fv(v0);
-
-        glTexCoord2f(0, 0);
-        glVertex3fv(v3);    // left face
-        glTexCoord2f(1, 0);
-        glVertex3fv(v7);
-        glTexCoord2f(1, 1);
-        glVertex3fv(v6);
-        glTexCoord2f(0, 1);
-        glVertex3fv(v2);
-
-        glTexCoord2f(0, 0);
-        glVertex3fv(v4);    // back face
-        glTexCoord2f(1, 0);
-        glVertex3fv(v7);
-        glTexCoord2f(1, 1);
-        glVertex3fv(v6);
-        glTexCoord2f(0, 1);
-        glVertex3fv(v5);
-
-        glTexCoord2f(0, 0);
-        glVertex3fv(v4);    // right face
-        glTexCoord2f(1, 0);
-        glVertex3fv(v0);
-        glTexCoord2f(1, 1);
-        glVertex3fv(v1);
-        glTexCoord2f(0, 1);
-        glVertex3fv(v5);
-
-        glTexCoord2f(0, 0);
-        glVertex3fv(v5);    // bottom face
-        glTexCoord2f(1, 0);
-        glVertex3fv(v1);
-        glTexCoord2f(1, 1);
-        glVertex3fv(v2);
-        glTexCoord2f(0, 1);
-        glVertex3fv(v6);
-
-        glEnd();
-        glDisable(GL_TEXTURE_2D);
-    }
+    RenderBackend::current().setColor(1.0, 1.0, 1.0, 1.0);
+    geometry.draw();
 }
@@ -0,0 +1,78 @@
+#include "glex/graphics/FixedFunctionRenderBackend.h"
+#include "glex/graphics/Geometry.h"
+
+#include <cstdint>
+
+void FixedFunctionRenderBackend::drawGeometry(Geometry& geometry) {
+#ifndef DREAMCAST
+    // Static geometry is compiled into a display list once, so the driver keeps its own copy and
+    // the arrays aren't read again. GLdc has no display lists, but the geometry's arrays are
+    // already a pre-built stream it submits directly, so there's nothing left to cache there.
+    if (geometry.isStatic) {
+        if (geometry.isDirty || geometry.displayList == 0) {
+            if (geometry.displayList == 0) {
+                geometry.displayList = glGenLists(1);
+            }
+            // Client array state isn't recorded in display lists, it's set while compiling and
+            // GLStateCache keeps tracking it as usual
+            glNewList(geometry.displayList, GL_COMPILE);
+            _drawArrays(geometry);
+            glEndList();
+            geometry.isDirty = false;
+        }
+        glCallList(geometry.displayList);
+        return;
+    }
+#endif
+
+    _drawArrays(geometry);
+    geometry.isDirty = false;
+}
+
+void FixedFunctionRenderBackend::_drawArrays(const Geometry& geometry) {
+    const VertexLayout& layout = geometry.layout;
+    const uint8_t* vertices = (const uint8_t*)geometry.vertices;
+
+    GLStateCache::enableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(3, GL_FLOAT, layout.stride, vertices + layout.positionOffset);
+
+    if (layout.normalOffset >= 0) {
+        GLStateCache::enableClientState(GL_NORMAL_ARRAY);
+        glNormalPointer(GL_FLOAT, layout.stride, vertices + layout.normalOffset);
+    } else {
+        GLStateCache::disableClientState(GL_NORMAL_ARRAY);
+    }
+
+    if (layout.texCoordOffset >= 0) {
+        GLStateCache::enableClientState(GL_TEXTURE_COORD_ARRAY);
+        glTexCoordPointer(2, GL_FLOAT, layout.stride, vertices + layout.texCoordOffset);
+    } else {
+        GLStateCache::disableClientState(GL_TEXTURE_COORD_ARRAY);
+    }
+
+    if (layout.colorOffset >= 0) {
+        GLStateCache::enableClientState(GL_COLOR_ARRAY);
+        glColorPointer(3, GL_FLOAT, layout.stride, vertices + layout.colorOffset);
+    } else {
+        GLStateCache::disableClientState(GL_COLOR_ARRAY);
+    }
+
+    if (geometry.indices != nullptr) {
+        glDrawElements(geometry.mode, geometry.indexCount, geometry.indexType, geometry.indices);
+    } else {
+        glDrawArrays(geometry.mode, 0, geometry.vertexCount);
+    }
+}
+
+void FixedFunctionRenderBackend::releaseGeometry(Geometry& geometry) {
+#ifndef DREAMCAST
+    if (geometry.displayList != 0) {
+        glDeleteLists(geometry.displayList, 1);
+        geometry.displayList = 0;
+    }
+#endif
+}
+
+void FixedFunctionRenderBackend::setColor(GLfloat r, GLfloat g, GLfloat b, GLfloat a) {
+    glColor4f(r, g, b, a);
+}
@@ -0,0 +1,83 @@
+#include "glex/graphics/FontTextureCache.h"
+#include "glex/graphics/RenderBackend.h"
+#include "glex/common/log.h"
+
+#include <vector>
+
+std::map<uint32_t, std::weak_ptr<Texture>> FontTextureCache::_textures;
+
+uint32_t FontTextureCache::_key(FontFace face, FontColor color) {
+    // Tinted textures are the same for every color
+    if (isTinted()) {
+        color = FONT_COLOR_WHITE;
+    }
+    return ((uint32_t)face << 24) | ((uint32_t)color.r << 16) | ((uint32_t)color.g << 8) | (uint32_t)color.b;
+}
+
+std::shared_ptr<Texture> FontTextureCache::texture(FontFace face, FontColor color) {
+    uint32_t key = _key(face, color);
+    auto existing = _textures.find(key);
+    if (existing != _textures.end()) {
+        std::shared_ptr<Texture> texture = existing->second.lock();
+        if (texture) {
+            return texture;
+        }
+    }
+
+    std::shared_ptr<Texture> texture = _createTexture(face, color);
+    _textures[key] = texture;
+    return texture;
+}
+
+size_t FontTextureCache::textureCount() {
+    size_t count = 0;
+    for (auto it = _textures.begin(); it != _textures.end();) {
+        if (it->second.expired()) {
+            it = _textures.erase(it);
+        } else {
+            count++;
+            it++;
+        }
+    }
+    return count;
+}
+
+std::shared_ptr<Texture> FontTextureCache::_createTexture(FontFace face, FontColor color) {
+    const texture_font_t* font = textureFontForFace(face);
+    GLsizei width = (GLsizei)font->tex_width;
+    GLsizei height = (GLsizei)font->tex_height;
+
+    GLuint textureId;
+    glGenTextures(1, &textureId);
+    GLStateCache::bindTexture(textureId);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+
+    if (isTinted() || color == FONT_COLOR_WHITE) {
+        // Use 8bit alpha only texture to save memory
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, width, height, 0, GL_ALPHA, GL_UNSIGNED_BYTE, font->tex_data);
+        RenderBackend::current().configureAlphaTexture();
+    } else {
+        // Convert the texture data to 32bit RGBA
+        size_t currentSize = font->tex_width * font->tex_height;
+        std::vector<uint8_t> rgbaData(currentSize * 4);
+        for (size_t i = 0; i < currentSize; i++) {
+            rgbaData[(i*4)]   = color.r;
+            rgbaData[(i*4)+1] = color.g;
+            rgbaData[(i*4)+2] = color.b;
+            rgbaData[(i*4)+3] = font->tex_data[i];
+        }
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, &rgbaData[0]);
+    }
+
+    GLenum error = glGetError();
+    if (error != GL_NO_ERROR) {
+        ERROR_PRINTLN("Failed to load font texture with GL error: %d", error);
+    }
+
+    std::shared_ptr<Texture> texture = std::make_shared<Texture>();
+    texture->loadExisting(width, height, textureId);
+    return texture;
+}
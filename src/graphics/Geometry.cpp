@@ -0,0 +1,44 @@
+#include "glex/graphics/Geometry.h"
+#include "glex/graphics/RenderBackend.h"
+
+Geometry::Geometry(const Geometry& other) {
+    _copyDescription(other);
+}
+
+Geometry& Geometry::operator=(const Geometry& other) {
+    if (this != &other) {
+        release();
+        _copyDescription(other);
+    }
+    return *this;
+}
+
+Geometry::~Geometry() {
+    release();
+}
+
+void Geometry::draw() {
+    if (vertexCount == 0 || vertices == nullptr) {
+        return;
+    }
+    RenderBackend::current().drawGeometry(*this);
+}
+
+void Geometry::release() {
+    if (vertexArray != 0 || vertexBuffer != 0 || indexBuffer != 0 || displayList != 0) {
+        RenderBackend::current().releaseGeometry(*this);
+    }
+    isDirty = true;
+}
+
+void Geometry::_copyDescription(const Geometry& other) {
+    mode = other.mode;
+    layout = other.layout;
+    vertices = other.vertices;
+    vertexCount = other.vertexCount;
+    indices = other.indices;
+    indexCount = other.indexCount;
+    indexType = other.indexType;
+    isStatic = other.isStatic;
+    isDirty = true;
+}
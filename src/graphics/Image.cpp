@@ -1,66 +1,85 @@
 #include "glex/graphics/Image.h"
+#include "glex/graphics/RenderQueue.h"
+#include "glex/graphics/SceneNode.h"
+#include "glex/graphics/RenderBackend.h"
 #include "glex/common/log.h"
+#include "glex/math/Matrix.h"
+
+#include <algorithm>
 
 void Image::draw() {
-    // Set OpenGL draw settings
-    glDisable(GL_LIGHTING);
-    glEnable(GL_DEPTH_TEST);
-    glDepthFunc(GL_LESS);
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    _renderState().apply();
+    _drawTransformed();
+}
 
+void Image::submit(RenderQueue& queue) {
+    queue.submit(_renderState(), RenderQueue::depthForOrthoZ(z), *this);
+}
+
+RenderState Image::_renderState() {
+    RenderState state;
+    state.blend = true;
+    state.textureId = texture->id;
+    return state;
+}
+
+void Image::_drawTransformed() {
     glPushMatrix();
 
-    // Perform scaling and rotation
-    glScalef(scale, scale, 1.0);
-    glRotatef(rotationY, 0.0f, 1.0f, 0.0f);
-    glRotatef(rotationX, 1.0f, 0.0f, 0.0f);
+    if (node != nullptr) {
+        // The node's cached matrix, no trig per frame
+        glMultMatrixf(node->worldMatrix().data());
+    } else {
+        // Perform scaling and rotation
+        glScalef(scale, scale, 1.0);
+        if (rotationX != 0 || rotationY != 0) {
+            glMultMatrixf(Matrix4::rotationZYX(rotationX, rotationY, 0.0f).data());
+        }
+    }
 
     _drawList();
 
-    // Unset OpenGL draw settings
-    glDisable(GL_BLEND);
-
     glPopMatrix();
 }
 
-void Image::_drawList() {
-    // Enable texture
-    glEnable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, texture->id);
-
-    // Define the vertex arrays 
-    float verts[] = { x,         y - height, z,   // Bottom Left
-                      x + width, y - height, z,   // Bottom Right
-                      x + width, y,          z,   // Top Right
-
-                      x,         y - height, z,   // Bottom Left
-                      x + width, y,          z,   // Top Right
-                      x,         y,          z }; // Top Left
+bool Image::_isVerticesDirty() {
+    return !_isVerticesBuilt || _builtX != x || _builtY != y || _builtZ != z || _builtWidth != width || _builtHeight != height ||
+           _builtUV.s0 != uv.s0 || _builtUV.t0 != uv.t0 || _builtUV.s1 != uv.s1 || _builtUV.t1 != uv.t1;
+}
 
+void Image::_buildVertices() {
     // TODO: Figure out why it seems like tex coords are flipped vertically compared to vert coords...
-    float texCoords[] = { 0, 0,   // Bottom Left
-                          1, 0,   // Bottom Right
-                          1, 1,   // Top Right
-
-                          0, 0,   // Bottom Left
-                          1, 1,   // Top Right 
-                          0, 1 }; // Top Left
+    const GLfloat vertices[] = { x,         y - height, z, uv.s0, uv.t0,   // Bottom Left
+                                 x + width, y - height, z, uv.s1, uv.t0,   // Bottom Right
+                                 x + width, y,          z, uv.s1, uv.t1,   // Top Right
+
+                                 x,         y - height, z, uv.s0, uv.t0,   // Bottom Left
+                                 x + width, y,          z, uv.s1, uv.t1,   // Top Right
+                                 x,         y,          z, uv.s0, uv.t1 }; // Top Left
+    std::copy(vertices, vertices + 6 * 5, _vertices);
+
+    _builtX = x;
+    _builtY = y;
+    _builtZ = z;
+    _builtWidth = width;
+    _builtHeight = height;
+    _builtUV = uv;
+    _isVerticesBuilt = true;
+    _geometry.invalidate();
+}
 
-    // Enable vertex and texture array drawing modes
-    glEnableClientState(GL_VERTEX_ARRAY);
-    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+void Image::_drawList() {
+    if (_isVerticesDirty()) {
+        _buildVertices();
+    }
 
-    // Specify the arrays to use
-    glVertexPointer(3, GL_FLOAT, 0, verts);
-    glTexCoordPointer(2, GL_FLOAT, 0, texCoords);
+    // Set every time since copies of an Image have their own vertices
+    _geometry.layout.stride = (GLsizei)(5 * sizeof(GLfloat));
+    _geometry.layout.texCoordOffset = (int)(3 * sizeof(GLfloat));
+    _geometry.vertices = _vertices;
+    _geometry.vertexCount = 6;
 
     // Draw the quad
-    glDrawArrays(GL_TRIANGLES, 0, 6);
-
-    // Disable vertex and texture array drawing modes
-    glDisableClientState(GL_VERTEX_ARRAY);
-    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
-
-    glDisable(GL_TEXTURE_2D);
-}
\ No newline at end of file
+    RenderBackend::current().setColor(1.0, 1.0, 1.0, 1.0);
+    _geometry.draw();
+}
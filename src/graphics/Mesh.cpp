@@ -1,18 +1,95 @@
 #include "glex/graphics/Mesh.h"
+#include "glex/graphics/RenderQueue.h"
+#include "glex/graphics/SceneNode.h"
+#include "glex/graphics/RenderBackend.h"
+#include "glex/graphics/TextureManager.h"
 #include "glex/common/log.h"
+#include "glex/common/frustum.h"
+#include "glex/common/path.h"
+#include "glex/math/Matrix.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 
 Mesh::Mesh(MeshData* meshData, Texture* texture, GLfloat scale) {
     _meshData = meshData;
     _texture = texture;
     _scale = scale;
+
+    _materialTextures.resize(_meshData->materials.size(), NULL);
+
+    _subMeshes = _meshData->subMeshes;
+    if (_subMeshes.empty() && _meshData->numIndices > 0) {
+        // Mesh data built without sub meshes is drawn as a single one
+        SubMesh subMesh;
+        subMesh.numVertices = _meshData->numVertices;
+        subMesh.numIndices = _meshData->numIndices;
+        _subMeshes.push_back(subMesh);
+    }
+
+    VertexLayout layout;
+    layout.stride = (GLsizei)sizeof(MeshVertex);
+    layout.positionOffset = (int)offsetof(MeshVertex, x);
+    layout.normalOffset = _meshData->hasNormals ? (int)offsetof(MeshVertex, nx) : -1;
+    layout.texCoordOffset = _meshData->hasTextureCoordinates ? (int)offsetof(MeshVertex, s) : -1;
+
+    // One geometry per sub mesh, each over its own range of the vertices and indices
+    _geometries.resize(_subMeshes.size());
+    for (size_t i = 0; i < _subMeshes.size(); i++) {
+        const SubMesh& subMesh = _subMeshes[i];
+        Geometry& geometry = _geometries[i];
+        // The mesh data doesn't change, so the backend can compile it once and keep it on the GPU
+        geometry.isStatic = true;
+        geometry.layout = layout;
+        if (subMesh.numIndices == 0) {
+            continue;
+        }
+        geometry.vertices = &_meshData->vertices[subMesh.vertexOffset];
+        geometry.vertexCount = (GLsizei)subMesh.numVertices;
+        geometry.indexCount = (GLsizei)subMesh.numIndices;
+        if (_meshData->isIndices16()) {
+            geometry.indices = &_meshData->indices16[subMesh.indexOffset];
+            geometry.indexType = GL_UNSIGNED_SHORT;
+        } else {
+            geometry.indices = &_meshData->indices32[subMesh.indexOffset];
+            geometry.indexType = GL_UNSIGNED_INT;
+        }
+    }
+}
+
+bool Mesh::loadMaterialTextures() {
+    bool success = true;
+    for (size_t i = 0; i < _meshData->materials.size(); i++) {
+        const std::string& path = _meshData->materials[i].diffuseTexturePath;
+        if (path.empty()) {
+            continue;
+        }
+
+        if (!glex::pathExists(glex::targetPlatformPath(path))) {
+            ERROR_PRINTLN("Mesh material texture not found: %s", path.c_str());
+            success = false;
+            continue;
+        }
+        // Shared with other materials and meshes using the same file
+        std::shared_ptr<Texture> texture = TextureManager::loadRGBA(path);
+        if (!texture) {
+            success = false;
+            continue;
+        }
+        _loadedTextures.push_back(texture);
+        _materialTextures[i] = texture.get();
+    }
+    return success;
+}
+
+void Mesh::setMaterialTexture(size_t materialIndex, Texture* texture) {
+    if (materialIndex < _materialTextures.size()) {
+        _materialTextures[materialIndex] = texture;
+    }
 }
 
 void Mesh::draw() {
-    // Enable depth test
-    glEnable(GL_DEPTH_TEST);
-    // Cull backfacing polygons 
-    glCullFace(GL_BACK); 
-    glEnable(GL_CULL_FACE);
     // Enable lighting
     //glEnable(GL_LIGHTING); 
     //glEnable(GL_LIGHT0);
@@ -21,16 +98,85 @@ void Mesh::draw() {
     //glEnable(GL_LIGHT1);
     // GLfloat lightpos1[] = {-1., 1., 1., 0.}; 
     // glLightfv(GL_LIGHT1, GL_POSITION, lightpos1);
-    // Accept fragment if it closer to the camera than the former one
-    glDepthFunc(GL_LESS);
+    if (!isVisible()) {
+        return;
+    }
+    _renderState().apply();
+    _drawTransformed();
+}
+
+void Mesh::submit(RenderQueue& queue) {
+    if (!isVisible()) {
+        return;
+    }
 
+    // Meshes have no position of their own, so they all sort at the same depth
+    queue.submit(_renderState(), 0.5, this, [](void* mesh) {
+        static_cast<Mesh*>(mesh)->_drawTransformed();
+    });
+}
+
+bool Mesh::isVisible() {
+    if (_meshData->numIndices == 0) {
+        return false;
+    }
+    const Frustum* frustum = Frustum::current();
+    if (!isCullingEnabled || frustum == nullptr) {
+        return true;
+    }
+
+    // Move the bounding sphere the same way _drawTransformed() moves the mesh
+    Matrix4 model;
+    float radiusScale;
+    if (node != nullptr) {
+        model = node->worldMatrix();
+        // Grow the radius by the largest scale of any axis
+        radiusScale = model.maxAxisScale();
+    } else {
+        model.scale(_scale, _scale, _scale);
+        model.rotateZYX(rotationX, rotationY, rotationZ);
+        radiusScale = fabsf(_scale);
+    }
+    const float* center = _meshData->boundingSphere.center;
+    Vector3 worldCenter = model.transformPoint(Vector3(center[0], center[1], center[2]));
+    BoundingSphere sphere;
+    sphere.center[0] = worldCenter.x;
+    sphere.center[1] = worldCenter.y;
+    sphere.center[2] = worldCenter.z;
+    sphere.radius = _meshData->boundingSphere.radius * radiusScale;
+    return frustum->intersects(sphere);
+}
+
+RenderState Mesh::_renderState() {
+    // Depth test and cull backfacing polygons
+    RenderState state;
+    state.cullFace = true;
+    // Sorted by the first sub mesh's texture, the rest are bound while drawing
+    Texture* texture = _subMeshes.empty() ? _texture : _subMeshTexture(_subMeshes[0]);
+    state.textureId = texture != NULL ? texture->id : 0;
+    return state;
+}
+
+Texture* Mesh::_subMeshTexture(const SubMesh& subMesh) {
+    if (subMesh.materialIndex >= 0 && _materialTextures[subMesh.materialIndex] != NULL) {
+        return _materialTextures[subMesh.materialIndex];
+    }
+    return _texture;
+}
+
+void Mesh::_drawTransformed() {
     glPushMatrix();
 
-    glScalef(_scale, _scale, _scale);
+    if (node != nullptr) {
+        // The node's cached matrix, no trig per frame
+        glMultMatrixf(node->worldMatrix().data());
+    } else {
+        glScalef(_scale, _scale, _scale);
 
-    glRotatef(rotationZ, 0.0f, 0.0f, 1.0f);
-    glRotatef(rotationY, 0.0f, 1.0f, 0.0f);
-    glRotatef(rotationX, 1.0f, 0.0f, 0.0f);
+        if (rotationX != 0 || rotationY != 0 || rotationZ != 0) {
+            glMultMatrixf(Matrix4::rotationZYX(rotationX, rotationY, rotationZ).data());
+        }
+    }
     
     //glTranslatef(1.0, -2.0, 1.0);
     
@@ -39,25 +185,29 @@ void Mesh::draw() {
 }
 
 void Mesh::_drawList() {
-    // Enable texture
-    glEnable(GL_TEXTURE_2D);
-    glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-    glBindTexture(GL_TEXTURE_2D, _texture->id);
-
-    // Draw the mesh
-    glEnableClientState(GL_VERTEX_ARRAY); //enable vertex array
-    glEnableClientState(GL_NORMAL_ARRAY); //enable normal array
-    glEnableClientState(GL_TEXTURE_COORD_ARRAY); //enable texcoord array
+    // The sub meshes are sorted by texture, so through GLStateCache each texture is bound once and
+    // each material is a single draw call. Shared vertices are only transformed once.
+    RenderState state = _renderState();
+    for (size_t i = 0; i < _subMeshes.size(); i++) {
+        const SubMesh& subMesh = _subMeshes[i];
+        Texture* texture = _subMeshTexture(subMesh);
+        state.textureId = texture != NULL ? texture->id : 0;
 
-    glVertexPointer(3, GL_FLOAT, 0, &_meshData->vertices[0]); //give vertex array to OGL
-    glTexCoordPointer(2, GL_FLOAT, 0, &_meshData->textureCoordinates[0]); //same with texcoord array
-    glNormalPointer(GL_FLOAT, 0, &_meshData->normals[0]); //and normal array
+        // Untextured materials are drawn in their diffuse color, textures aren't tinted by it
+        GLfloat color[4] = { 1.0, 1.0, 1.0, 1.0 };
+        if (subMesh.materialIndex >= 0) {
+            const MeshMaterial& material = _meshData->materials[subMesh.materialIndex];
+            if (state.textureId == 0) {
+                color[0] = material.diffuse[0];
+                color[1] = material.diffuse[1];
+                color[2] = material.diffuse[2];
+            }
+            color[3] = material.opacity;
+        }
+        state.blend = color[3] < 1.0;
 
-    glDrawArrays(GL_TRIANGLES, 0, (GLsizei)_meshData->numVertices);
-
-    glDisableClientState(GL_VERTEX_ARRAY); //disable the client states again
-    glDisableClientState(GL_NORMAL_ARRAY);
-    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
-
-    glDisable(GL_TEXTURE_2D);
-}
\ No newline at end of file
+        state.apply();
+        RenderBackend::current().setColor(color[0], color[1], color[2], color[3]);
+        _geometries[i].draw();
+    }
+}
@@ -1,13 +1,257 @@
 #include "glex/graphics/MeshLoader.h"
 #include "glex/common/log.h"
 #include "glex/common/path.h"
+#include "glex/common/meshfile.h"
 
 #define TINYOBJLOADER_IMPLEMENTATION // define this in only *one* .cpp file
 #include "objl/tiny_obj_loader.h"
 
 #include <fstream>
+#include <cstdio>
 #include <cstring>
 #include <cstdlib>
+#include <map>
+#include <unordered_map>
+#include <algorithm>
+#include <cmath>
+
+#ifndef DREAMCAST
+#include <thread>
+#endif
+
+// The position, normal and texture coordinate indices of a face corner
+struct ObjIndex {
+    int vertex;
+    int normal;
+    int textureCoordinate;
+
+    bool operator==(const ObjIndex& other) const {
+        return vertex == other.vertex && normal == other.normal && textureCoordinate == other.textureCoordinate;
+    }
+};
+
+struct ObjIndexHash {
+    size_t operator()(const ObjIndex& index) const {
+        size_t hash = (size_t)index.vertex * 73856093u;
+        hash ^= (size_t)index.normal * 19349663u;
+        hash ^= (size_t)index.textureCoordinate * 83492791u;
+        return hash;
+    }
+};
+
+static void _calculateBounds(MeshData* meshData) {
+    if (meshData->vertices.empty()) {
+        return;
+    }
+
+    BoundingBox& box = meshData->boundingBox;
+    const MeshVertex& first = meshData->vertices[0];
+    box.min[0] = box.max[0] = first.x;
+    box.min[1] = box.max[1] = first.y;
+    box.min[2] = box.max[2] = first.z;
+    for (const MeshVertex& vertex : meshData->vertices) {
+        box.min[0] = std::min(box.min[0], vertex.x);
+        box.min[1] = std::min(box.min[1], vertex.y);
+        box.min[2] = std::min(box.min[2], vertex.z);
+        box.max[0] = std::max(box.max[0], vertex.x);
+        box.max[1] = std::max(box.max[1], vertex.y);
+        box.max[2] = std::max(box.max[2], vertex.z);
+    }
+
+    // Centered on the box, with the radius to the farthest vertex (tighter than the box's corners)
+    BoundingSphere& sphere = meshData->boundingSphere;
+    float radiusSquared = 0;
+    for (int i = 0; i < 3; i++) {
+        sphere.center[i] = (box.min[i] + box.max[i]) * 0.5f;
+    }
+    for (const MeshVertex& vertex : meshData->vertices) {
+        float dx = vertex.x - sphere.center[0];
+        float dy = vertex.y - sphere.center[1];
+        float dz = vertex.z - sphere.center[2];
+        radiusSquared = std::max(radiusSquared, dx * dx + dy * dy + dz * dz);
+    }
+    sphere.radius = sqrtf(radiusSquared);
+}
+
+// Runs task(0) to task(count - 1), each on its own thread (the calling thread runs task 0)
+template <typename Task>
+static void _runParallel(size_t count, const Task& task) {
+#ifdef DREAMCAST
+    // The SH4 has a single core, threads would only add overhead
+    for (size_t i = 0; i < count; i++) {
+        task(i);
+    }
+#else
+    std::vector<std::thread> threads;
+    threads.reserve(count > 0 ? count - 1 : 0);
+    for (size_t i = 1; i < count; i++) {
+        threads.emplace_back([&task, i]() { task(i); });
+    }
+    if (count > 0) {
+        task(0);
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+#endif
+}
+
+static unsigned _defaultThreadCount() {
+#ifdef DREAMCAST
+    return 1;
+#else
+    unsigned count = std::thread::hardware_concurrency();
+    return count > 0 ? count : 1;
+#endif
+}
+
+// The unique vertices of a run of face corners, and the corners as indices into them
+struct IndexedCorners {
+    std::vector<MeshVertex> vertices;
+    std::vector<uint32_t> indices;
+};
+
+static void _indexCorners(const tinyobj::attrib_t& attrib, const tinyobj::index_t* corners, size_t numCorners, IndexedCorners& indexed) {
+    // Face corners that share the same position, normal and texture coordinate become one vertex
+    std::unordered_map<ObjIndex, uint32_t, ObjIndexHash> uniqueVertices;
+    uniqueVertices.reserve(numCorners);
+    indexed.vertices.reserve(numCorners);
+    indexed.indices.reserve(numCorners);
+
+    for (size_t i = 0; i < numCorners; i++) {
+        const tinyobj::index_t& idx = corners[i];
+        ObjIndex key = { idx.vertex_index, idx.normal_index, idx.texcoord_index };
+        auto existing = uniqueVertices.find(key);
+        if (existing != uniqueVertices.end()) {
+            indexed.indices.push_back(existing->second);
+            continue;
+        }
+
+        uint32_t vertexIndex = (uint32_t)indexed.vertices.size();
+        uniqueVertices[key] = vertexIndex;
+        indexed.indices.push_back(vertexIndex);
+
+        MeshVertex vertex = {};
+        vertex.x = attrib.vertices[3*(size_t)idx.vertex_index+0];
+        vertex.y = attrib.vertices[3*(size_t)idx.vertex_index+1];
+        vertex.z = attrib.vertices[3*(size_t)idx.vertex_index+2];
+
+        // Corners without a normal or texture coordinate are left as zeros
+        if (idx.normal_index >= 0) {
+            vertex.nx = attrib.normals[3*(size_t)idx.normal_index+0];
+            vertex.ny = attrib.normals[3*(size_t)idx.normal_index+1];
+            vertex.nz = attrib.normals[3*(size_t)idx.normal_index+2];
+        }
+        if (idx.texcoord_index >= 0) {
+            vertex.s = attrib.texcoords[2*(size_t)idx.texcoord_index+0];
+            vertex.t = attrib.texcoords[2*(size_t)idx.texcoord_index+1];
+        }
+        indexed.vertices.push_back(vertex);
+        // Optional: vertex colors
+        // tinyobj::real_t red = attrib.colors[3*idx.vertex_index+0];
+        // tinyobj::real_t green = attrib.colors[3*idx.vertex_index+1];
+        // tinyobj::real_t blue = attrib.colors[3*idx.vertex_index+2];
+    }
+}
+
+// Sub meshes with fewer corners than this are indexed on a single thread
+static constexpr size_t PARALLEL_INDEXING_MIN_CORNERS = 3 * 65536;
+
+/*
+ * Builds the mesh from triangle corners gathered by material (slot 0 holds the faces without
+ * one). Each material becomes a sub mesh, sorted by texture.
+ *
+ * With more than one thread, large sub meshes are indexed in parallel ranges of triangles. Only
+ * vertices shared between two ranges are duplicated, one copy per range, which costs a little
+ * memory but draws the same.
+ */
+static MeshData* _buildObjMeshData(const tinyobj::attrib_t& attrib, const std::vector<tinyobj::material_t>& materials,
+                                   const std::vector<std::vector<tinyobj::index_t>>& materialCorners, const std::string& directory,
+                                   unsigned threadCount) {
+    MeshData* meshData = new MeshData();
+    meshData->hasNormals = !attrib.normals.empty();
+    meshData->hasTextureCoordinates = !attrib.texcoords.empty();
+
+    for (const tinyobj::material_t& objMaterial : materials) {
+        MeshMaterial material;
+        material.name = objMaterial.name;
+        for (int i = 0; i < 3; i++) {
+            material.diffuse[i] = objMaterial.diffuse[i];
+        }
+        material.opacity = objMaterial.dissolve;
+        if (!objMaterial.diffuse_texname.empty()) {
+            material.diffuseTextureName = objMaterial.diffuse_texname;
+            material.diffuseTexturePath = directory + material.diffuseTextureName;
+        }
+        meshData->materials.push_back(material);
+    }
+
+    // Order the sub meshes by texture so consecutive ones can share a bind
+    std::vector<int> materialOrder;
+    size_t numCorners = 0;
+    for (int materialId = -1; materialId < (int)materials.size(); materialId++) {
+        if (!materialCorners[materialId + 1].empty()) {
+            materialOrder.push_back(materialId);
+            numCorners += materialCorners[materialId + 1].size();
+        }
+    }
+    std::stable_sort(materialOrder.begin(), materialOrder.end(), [meshData](int a, int b) {
+        const std::string& textureA = a < 0 ? "" : meshData->materials[a].diffuseTexturePath;
+        const std::string& textureB = b < 0 ? "" : meshData->materials[b].diffuseTexturePath;
+        return textureA < textureB;
+    });
+
+    // Vertices aren't shared across sub meshes, so each one's vertices stay contiguous
+    std::vector<uint32_t> indices;
+    indices.reserve(numCorners);
+    meshData->vertices.reserve(numCorners);
+    size_t maxSubMeshVertices = 0;
+
+    for (int materialId : materialOrder) {
+        const std::vector<tinyobj::index_t>& corners = materialCorners[materialId + 1];
+        SubMesh subMesh;
+        subMesh.materialIndex = materialId;
+        subMesh.vertexOffset = meshData->vertices.size();
+        subMesh.indexOffset = indices.size();
+
+        // Split into ranges of whole triangles
+        size_t numRanges = corners.size() >= PARALLEL_INDEXING_MIN_CORNERS ? threadCount : 1;
+        size_t numTriangles = corners.size() / 3;
+        std::vector<IndexedCorners> ranges(numRanges);
+        _runParallel(numRanges, [&](size_t range) {
+            size_t first = numTriangles * range / numRanges * 3;
+            size_t last = range + 1 == numRanges ? corners.size() : numTriangles * (range + 1) / numRanges * 3;
+            _indexCorners(attrib, corners.data() + first, last - first, ranges[range]);
+        });
+
+        for (IndexedCorners& range : ranges) {
+            uint32_t base = (uint32_t)subMesh.numVertices;
+            for (uint32_t index : range.indices) {
+                indices.push_back(base + index);
+            }
+            meshData->vertices.insert(meshData->vertices.end(), range.vertices.begin(), range.vertices.end());
+            subMesh.numVertices += range.vertices.size();
+        }
+
+        subMesh.numIndices = indices.size() - subMesh.indexOffset;
+        maxSubMeshVertices = std::max(maxSubMeshVertices, subMesh.numVertices);
+        meshData->subMeshes.push_back(subMesh);
+    }
+
+    // The vertices were reserved for the worst case of no sharing at all
+    meshData->numVertices = meshData->vertices.size();
+    meshData->vertices.shrink_to_fit();
+    _calculateBounds(meshData);
+
+    // Use 16 bit indices when they fit, they're half the size
+    meshData->numIndices = indices.size();
+    if (maxSubMeshVertices <= 0xFFFF + 1) {
+        meshData->indices16.assign(indices.begin(), indices.end());
+    } else {
+        meshData->indices32 = std::move(indices);
+    }
+    return meshData;
+}
 
 MeshData* MeshLoader::loadObjMesh(std::string path) { 
     std::string platformPath = glex::targetPlatformPath(path);
@@ -20,7 +264,10 @@ MeshData* MeshLoader::loadObjMesh(std::string path) {
     std::string warn;
     std::string err;
 
-    bool success = tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, platformPath.c_str());
+    // MTL files and textures are relative to the OBJ file
+    std::string directory = path.substr(0, path.find_last_of('/') + 1);
+    std::string platformDirectory = platformPath.substr(0, platformPath.find_last_of('/') + 1);
+    bool success = tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, platformPath.c_str(), platformDirectory.c_str());
 
     if (!warn.empty()) {
         ERROR_PRINTLN("Warning while loading mesh: %s", warn.c_str());
@@ -32,50 +279,640 @@ MeshData* MeshLoader::loadObjMesh(std::string path) {
         return NULL;
     }
 
-    // TODO: Load objs with more than one shape
-    // TODO: Load materials
-    // TODO: Switch to rendering the tiny_obj_loader format directly to save processing and memory
+    // Gather the face corners of every shape by material, slot 0 is for faces without one
+    std::vector<std::vector<tinyobj::index_t>> materialCorners(materials.size() + 1);
+    for (const tinyobj::shape_t& shape : shapes) {
+        const tinyobj::mesh_t& mesh = shape.mesh;
+        size_t index_offset = 0;
+        for (size_t f = 0; f < mesh.num_face_vertices.size(); f++) {
+            size_t fv = mesh.num_face_vertices[f];
+            int materialId = f < mesh.material_ids.size() ? mesh.material_ids[f] : -1;
+            if (materialId < 0 || materialId >= (int)materials.size()) {
+                materialId = -1;
+            }
+            std::vector<tinyobj::index_t>& corners = materialCorners[materialId + 1];
+            corners.insert(corners.end(), mesh.indices.begin() + index_offset, mesh.indices.begin() + index_offset + fv);
+            index_offset += fv;
+        }
+    }
+
+    MeshData* meshData = _buildObjMeshData(attrib, materials, materialCorners, directory, 1);
+    DEBUG_PRINTLN("Finished loading mesh %s (%d vertices, %d indices, %d sub meshes)", platformPath.c_str(), (int)meshData->numVertices, (int)meshData->numIndices, (int)meshData->subMeshes.size());
+    return meshData;
+}
+
+//
+// Parallel OBJ parsing
+//
+
+// The parts of the OBJ format meshes use, everything else (groups, smoothing, ...) is skipped
+enum class ObjLineType {
+    Other,
+    Position,
+    TextureCoordinate,
+    Normal,
+    Face,
+    UseMaterial,
+    MaterialLibrary
+};
+
+static inline bool _isObjSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+static inline const char* _skipObjSpaces(const char* p) {
+    while (_isObjSpace(*p)) {
+        p++;
+    }
+    return p;
+}
+
+// Returns the type of the line starting at p, and moves p past the keyword
+static ObjLineType _objLineType(const char*& p) {
+    p = _skipObjSpaces(p);
+    ObjLineType type = ObjLineType::Other;
+    size_t length = 0;
+    if (p[0] == 'v' && _isObjSpace(p[1])) {
+        type = ObjLineType::Position;
+        length = 1;
+    } else if (p[0] == 'v' && p[1] == 't' && _isObjSpace(p[2])) {
+        type = ObjLineType::TextureCoordinate;
+        length = 2;
+    } else if (p[0] == 'v' && p[1] == 'n' && _isObjSpace(p[2])) {
+        type = ObjLineType::Normal;
+        length = 2;
+    } else if (p[0] == 'f' && _isObjSpace(p[1])) {
+        type = ObjLineType::Face;
+        length = 1;
+    } else if (strncmp(p, "usemtl", 6) == 0 && _isObjSpace(p[6])) {
+        type = ObjLineType::UseMaterial;
+        length = 6;
+    } else if (strncmp(p, "mtllib", 6) == 0 && _isObjSpace(p[6])) {
+        type = ObjLineType::MaterialLibrary;
+        length = 6;
+    }
+    p += length;
+    return type;
+}
+
+static inline const char* _nextObjLine(const char* p, const char* end) {
+    const char* newline = (const char*)memchr(p, '\n', end - p);
+    return newline != NULL ? newline + 1 : end;
+}
+
+// Locale independent and much faster than strtof, exact to float precision for OBJ style numbers
+static float _parseObjFloat(const char*& p) {
+    static const double POWERS_OF_TEN[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18 };
+    p = _skipObjSpaces(p);
+    bool isNegative = *p == '-';
+    if (*p == '-' || *p == '+') {
+        p++;
+    }
+
+    // Accumulate up to 18 significant digits, ignore the rest apart from their magnitude
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+    for (; *p >= '0' && *p <= '9'; p++) {
+        if (digits < 18) {
+            mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+            digits += mantissa > 0;
+        } else {
+            exponent++;
+        }
+    }
+    if (*p == '.') {
+        for (p++; *p >= '0' && *p <= '9'; p++) {
+            if (digits < 18) {
+                mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+                digits += mantissa > 0;
+                exponent--;
+            }
+        }
+    }
+    if (*p == 'e' || *p == 'E') {
+        p++;
+        bool isExponentNegative = *p == '-';
+        if (*p == '-' || *p == '+') {
+            p++;
+        }
+        int value = 0;
+        for (; *p >= '0' && *p <= '9'; p++) {
+            value = std::min(value * 10 + (*p - '0'), 1000);
+        }
+        exponent += isExponentNegative ? -value : value;
+    }
+
+    double result = (double)mantissa;
+    if (exponent < 0) {
+        result = exponent >= -18 ? result / POWERS_OF_TEN[-exponent] : result * pow(10.0, exponent);
+    } else if (exponent > 0) {
+        result = exponent <= 18 ? result * POWERS_OF_TEN[exponent] : result * pow(10.0, exponent);
+    }
+    return (float)(isNegative ? -result : result);
+}
+
+// Parses a 1 based (or negative, relative to the end) index and returns it 0 based, or -1 if absent
+static inline int _parseObjIndex(const char*& p, size_t countSoFar) {
+    bool isNegative = *p == '-';
+    if (isNegative) {
+        p++;
+    }
+    if (*p < '0' || *p > '9') {
+        return -1;
+    }
+    int value = 0;
+    for (; *p >= '0' && *p <= '9'; p++) {
+        value = value * 10 + (*p - '0');
+    }
+    return isNegative ? (int)countSoFar - value : value - 1;
+}
+
+static inline std::string _parseObjName(const char* p, const char* end) {
+    p = _skipObjSpaces(p);
+    const char* nameEnd = p;
+    while (nameEnd < end && *nameEnd != '\n' && *nameEnd != '\r' && *nameEnd != '#') {
+        nameEnd++;
+    }
+    while (nameEnd > p && _isObjSpace(nameEnd[-1])) {
+        nameEnd--;
+    }
+    return std::string(p, nameEnd);
+}
+
+// What one thread parsed from its part of the file
+struct ObjChunk {
+    const char* begin = nullptr;
+    const char* end = nullptr;
+
+    size_t numPositions = 0;
+    size_t numTextureCoordinates = 0;
+    size_t numNormals = 0;
+    // Where this chunk's attributes start in the file's arrays
+    size_t firstPosition = 0;
+    size_t firstTextureCoordinate = 0;
+    size_t firstNormal = 0;
+
+    // Triangle corners by material slot. Slot 0 is whatever material was in use when the chunk
+    // started (only known once the previous chunks are parsed), slot n is the nth usemtl.
+    std::vector<std::string> materialNames;
+    std::vector<std::vector<tinyobj::index_t>> slotCorners;
+    size_t lastSlot = 0;
+    std::vector<std::string> materialLibraries;
+    bool isValid = true;
+};
+
+static void _countObjChunk(ObjChunk& chunk) {
+    for (const char* p = chunk.begin; p < chunk.end; p = _nextObjLine(p, chunk.end)) {
+        const char* line = p;
+        switch (_objLineType(line)) {
+        case ObjLineType::Position:
+            chunk.numPositions++;
+            break;
+        case ObjLineType::TextureCoordinate:
+            chunk.numTextureCoordinates++;
+            break;
+        case ObjLineType::Normal:
+            chunk.numNormals++;
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+static void _parseObjChunk(ObjChunk& chunk, tinyobj::attrib_t& attrib) {
+    size_t position = chunk.firstPosition;
+    size_t textureCoordinate = chunk.firstTextureCoordinate;
+    size_t normal = chunk.firstNormal;
+    const size_t totalPositions = attrib.vertices.size() / 3;
+    const size_t totalTextureCoordinates = attrib.texcoords.size() / 2;
+    const size_t totalNormals = attrib.normals.size() / 3;
+
+    chunk.slotCorners.resize(1);
+    std::vector<tinyobj::index_t> face;
+
+    for (const char* p = chunk.begin; p < chunk.end; p = _nextObjLine(p, chunk.end)) {
+        const char* line = p;
+        switch (_objLineType(line)) {
+        case ObjLineType::Position: {
+            // Each chunk writes straight into its own range of the shared arrays
+            float* destination = &attrib.vertices[3 * position++];
+            destination[0] = _parseObjFloat(line);
+            destination[1] = _parseObjFloat(line);
+            destination[2] = _parseObjFloat(line);
+            break;
+        }
+        case ObjLineType::TextureCoordinate: {
+            float* destination = &attrib.texcoords[2 * textureCoordinate++];
+            destination[0] = _parseObjFloat(line);
+            destination[1] = _parseObjFloat(line);
+            break;
+        }
+        case ObjLineType::Normal: {
+            float* destination = &attrib.normals[3 * normal++];
+            destination[0] = _parseObjFloat(line);
+            destination[1] = _parseObjFloat(line);
+            destination[2] = _parseObjFloat(line);
+            break;
+        }
+        case ObjLineType::Face: {
+            // v, v/vt, v//vn or v/vt/vn per corner
+            face.clear();
+            line = _skipObjSpaces(line);
+            while (*line != '\n' && *line != '\0' && *line != '#' && line < chunk.end) {
+                tinyobj::index_t index;
+                index.vertex_index = _parseObjIndex(line, position);
+                index.texcoord_index = -1;
+                index.normal_index = -1;
+                if (*line == '/') {
+                    line++;
+                    index.texcoord_index = _parseObjIndex(line, textureCoordinate);
+                    if (*line == '/') {
+                        line++;
+                        index.normal_index = _parseObjIndex(line, normal);
+                    }
+                }
+                if (index.vertex_index < 0 || index.vertex_index >= (int)totalPositions ||
+                    index.texcoord_index >= (int)totalTextureCoordinates || index.normal_index >= (int)totalNormals ||
+                    !(_isObjSpace(*line) || *line == '\n' || *line == '\0' || *line == '#')) {
+                    chunk.isValid = false;
+                    return;
+                }
+                face.push_back(index);
+                line = _skipObjSpaces(line);
+            }
+
+            // Triangulate as a fan, like tinyobjloader does
+            std::vector<tinyobj::index_t>& corners = chunk.slotCorners[chunk.lastSlot];
+            for (size_t i = 2; i < face.size(); i++) {
+                corners.push_back(face[0]);
+                corners.push_back(face[i - 1]);
+                corners.push_back(face[i]);
+            }
+            break;
+        }
+        case ObjLineType::UseMaterial:
+            chunk.materialNames.push_back(_parseObjName(line, chunk.end));
+            chunk.slotCorners.emplace_back();
+            chunk.lastSlot = chunk.slotCorners.size() - 1;
+            break;
+        case ObjLineType::MaterialLibrary:
+            chunk.materialLibraries.push_back(_parseObjName(line, chunk.end));
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+MeshData* MeshLoader::loadObjMeshParallel(std::string path, unsigned threadCount) {
+    std::string platformPath = glex::targetPlatformPath(path);
+    DEBUG_PRINTLN("Started loading mesh %s in parallel", platformPath.c_str());
+    if (threadCount == 0) {
+        threadCount = _defaultThreadCount();
+    }
+
+    // Read the whole file at once, zero terminated so parsing never needs to check the end
+    std::ifstream file(platformPath, std::ios::binary | std::ios::ate);
+    if (!file) {
+        ERROR_PRINTLN("Couldn't open mesh file %s", platformPath.c_str());
+        return NULL;
+    }
+    std::vector<char> text((size_t)file.tellg() + 1, '\0');
+    file.seekg(0);
+    file.read(text.data(), text.size() - 1);
+    file.close();
+    const char* begin = text.data();
+    const char* end = begin + text.size() - 1;
+
+    // Line aligned chunks, one per thread
+    std::vector<ObjChunk> chunks(threadCount);
+    const char* chunkBegin = begin;
+    for (unsigned i = 0; i < threadCount; i++) {
+        ObjChunk& chunk = chunks[i];
+        chunk.begin = chunkBegin;
+        chunk.end = i + 1 == threadCount ? end : std::max(chunkBegin, begin + (end - begin) * (i + 1) / threadCount);
+        if (chunk.end < end && chunk.end > chunk.begin && chunk.end[-1] != '\n') {
+            chunk.end = _nextObjLine(chunk.end, end);
+        }
+        chunkBegin = chunk.end;
+    }
+
+    // Count the attributes in each chunk first, so every chunk knows where its own attributes go
+    // (and what relative indices refer to) before parsing
+    _runParallel(chunks.size(), [&chunks](size_t i) {
+        _countObjChunk(chunks[i]);
+    });
+    size_t numPositions = 0, numTextureCoordinates = 0, numNormals = 0;
+    for (ObjChunk& chunk : chunks) {
+        chunk.firstPosition = numPositions;
+        chunk.firstTextureCoordinate = numTextureCoordinates;
+        chunk.firstNormal = numNormals;
+        numPositions += chunk.numPositions;
+        numTextureCoordinates += chunk.numTextureCoordinates;
+        numNormals += chunk.numNormals;
+    }
+
+    tinyobj::attrib_t attrib;
+    attrib.vertices.resize(numPositions * 3);
+    attrib.texcoords.resize(numTextureCoordinates * 2);
+    attrib.normals.resize(numNormals * 3);
+    _runParallel(chunks.size(), [&chunks, &attrib](size_t i) {
+        _parseObjChunk(chunks[i], attrib);
+    });
+    std::vector<char>().swap(text);
+
+    for (const ObjChunk& chunk : chunks) {
+        if (!chunk.isValid) {
+            ERROR_PRINTLN("Error while loading mesh: invalid face in %s", platformPath.c_str());
+            return NULL;
+        }
+    }
+
+    // MTL files and textures are relative to the OBJ file
+    std::string directory = path.substr(0, path.find_last_of('/') + 1);
+    std::string platformDirectory = platformPath.substr(0, platformPath.find_last_of('/') + 1);
+    std::vector<tinyobj::material_t> materials;
+    std::map<std::string, int> materialIds;
+    std::vector<std::string> loadedLibraries;
+    for (const ObjChunk& chunk : chunks) {
+        for (const std::string& library : chunk.materialLibraries) {
+            if (std::find(loadedLibraries.begin(), loadedLibraries.end(), library) != loadedLibraries.end()) {
+                continue;
+            }
+            loadedLibraries.push_back(library);
+            std::ifstream stream(platformDirectory + library);
+            if (!stream) {
+                ERROR_PRINTLN("Warning while loading mesh: material library %s not found", library.c_str());
+                continue;
+            }
+            std::string warn;
+            std::string err;
+            tinyobj::LoadMtl(&materialIds, &materials, &stream, &warn, &err);
+            if (!warn.empty()) {
+                ERROR_PRINTLN("Warning while loading mesh: %s", warn.c_str());
+            }
+            if (!err.empty()) {
+                ERROR_PRINTLN("Error while loading mesh: %s", err.c_str());
+            }
+        }
+    }
+
+    // Each chunk starts with the material the previous one ended with
+    std::vector<std::vector<tinyobj::index_t>> materialCorners(materials.size() + 1);
+    int currentMaterial = -1;
+    for (ObjChunk& chunk : chunks) {
+        std::vector<int> slotMaterials(chunk.slotCorners.size(), currentMaterial);
+        for (size_t slot = 1; slot < chunk.slotCorners.size(); slot++) {
+            auto material = materialIds.find(chunk.materialNames[slot - 1]);
+            slotMaterials[slot] = material != materialIds.end() ? material->second : -1;
+        }
+        for (size_t slot = 0; slot < chunk.slotCorners.size(); slot++) {
+            std::vector<tinyobj::index_t>& corners = materialCorners[slotMaterials[slot] + 1];
+            if (corners.empty()) {
+                corners.swap(chunk.slotCorners[slot]);
+            } else {
+                corners.insert(corners.end(), chunk.slotCorners[slot].begin(), chunk.slotCorners[slot].end());
+            }
+            std::vector<tinyobj::index_t>().swap(chunk.slotCorners[slot]);
+        }
+        currentMaterial = slotMaterials[chunk.lastSlot];
+    }
+
+    MeshData* meshData = _buildObjMeshData(attrib, materials, materialCorners, directory, threadCount);
+    DEBUG_PRINTLN("Finished loading mesh %s (%d vertices, %d indices, %d sub meshes, %d threads)", platformPath.c_str(), (int)meshData->numVertices, (int)meshData->numIndices, (int)meshData->subMeshes.size(), (int)threadCount);
+    return meshData;
+}
+
+static uint32_t _alignMeshFileOffset(size_t offset) {
+    return (uint32_t)((offset + MESH_FILE_ALIGNMENT - 1) & ~(size_t)(MESH_FILE_ALIGNMENT - 1));
+}
+
+// Checks count elements of elementSize bytes at offset are inside the file, without overflowing
+static bool _isMeshFileSectionValid(const MeshFileHeader& header, uint32_t offset, uint32_t count, size_t elementSize) {
+    return (uint64_t)offset + (uint64_t)count * elementSize <= header.fileSize;
+}
+
+// Copies a section out of the file's buffer (already checked with _isMeshFileSectionValid())
+template<typename Element>
+static void _copyMeshFileSection(const std::vector<uint8_t>& buffer, uint32_t offset, std::vector<Element>& destination) {
+    if (!destination.empty()) {
+        memcpy(destination.data(), &buffer[offset], destination.size() * sizeof(Element));
+    }
+}
+
+// Checks every index of a sub mesh points at one of its own vertices
+template<typename Index>
+static bool _isSubMeshIndicesValid(const std::vector<Index>& indices, const SubMesh& subMesh) {
+    for (size_t i = subMesh.indexOffset; i < subMesh.indexOffset + subMesh.numIndices; i++) {
+        if (indices[i] >= subMesh.numVertices) {
+            return false;
+        }
+    }
+    return true;
+}
+
+MeshData* MeshLoader::loadBinaryMesh(std::string path) {
+    std::string platformPath = glex::targetPlatformPath(path);
+    DEBUG_PRINTLN("Started loading binary mesh %s", platformPath.c_str());
+
+    FILE* file = fopen(platformPath.c_str(), "rb");
+    if (file == NULL) {
+        ERROR_PRINTLN("Couldn't open mesh file %s", platformPath.c_str());
+        return NULL;
+    }
+    long fileLength = -1;
+    if (fseek(file, 0, SEEK_END) == 0) {
+        fileLength = ftell(file);
+    }
+
+    MeshFileHeader header;
+    if (fileLength < (long)sizeof(header) || fseek(file, 0, SEEK_SET) != 0 ||
+        fread(&header, 1, sizeof(header), file) != sizeof(header) || memcmp(header.magic, MESH_FILE_MAGIC, sizeof(header.magic)) != 0) {
+        ERROR_PRINTLN("Not a glexmesh file: %s", platformPath.c_str());
+        fclose(file);
+        return NULL;
+    }
+    if (header.version != MESH_FILE_VERSION) {
+        ERROR_PRINTLN("Unsupported glexmesh version %d (expected %d): %s", (int)header.version, (int)MESH_FILE_VERSION, platformPath.c_str());
+        fclose(file);
+        return NULL;
+    }
+
+    // Nothing in the header is trusted until it's checked against the real file, so a corrupt
+    // count can't make us allocate more than the file holds
+    const bool isIndices16 = (header.flags & MESH_FILE_INDICES_16) != 0;
+    if (header.fileSize < sizeof(header) || header.fileSize > (unsigned long)fileLength ||
+        !_isMeshFileSectionValid(header, header.materialsOffset, header.numMaterials, sizeof(MeshFileMaterial)) ||
+        !_isMeshFileSectionValid(header, header.subMeshesOffset, header.numSubMeshes, sizeof(MeshFileSubMesh)) ||
+        !_isMeshFileSectionValid(header, header.verticesOffset, header.numVertices, sizeof(MeshVertex)) ||
+        !_isMeshFileSectionValid(header, header.indicesOffset, header.numIndices, isIndices16 ? sizeof(uint16_t) : sizeof(uint32_t))) {
+        ERROR_PRINTLN("Truncated or corrupt glexmesh file: %s", platformPath.c_str());
+        fclose(file);
+        return NULL;
+    }
+
+    // Read the whole file at once, the sections are in the same layout as in memory
+    std::vector<uint8_t> buffer(header.fileSize);
+    bool success = fseek(file, 0, SEEK_SET) == 0 && fread(buffer.data(), 1, buffer.size(), file) == buffer.size();
+    fclose(file);
+    if (!success) {
+        ERROR_PRINTLN("Couldn't read mesh file %s", platformPath.c_str());
+        return NULL;
+    }
+
     MeshData* meshData = new MeshData();
-    meshData->numVertices = shapes[0].mesh.indices.size();
-    std::vector<float> finalVertices((size_t)meshData->numVertices * 3);
-    std::vector<float> finalTextCoords((size_t)meshData->numVertices * 2);
-    std::vector<float> finalNormals((size_t)meshData->numVertices * 3);
-    int vertCount = 0;
-    int textCoordCount = 0;
-    int normalCount = 0;
-    size_t index_offset = 0;
-    for (size_t f = 0; f < shapes[0].mesh.num_face_vertices.size(); f++) {
-        size_t fv = shapes[0].mesh.num_face_vertices[f];
-
-        // Loop over vertices in the face.
-        for (size_t v = 0; v < fv; v++) {
-
-            // access to vertex
-            tinyobj::index_t idx = shapes[0].mesh.indices[index_offset + v];
-            // DEBUG_PRINTLN("idx - vertex %d  normal: %d  texCoord: %d", idx.vertex_index, idx.normal_index, idx.texcoord_index);
-            tinyobj::real_t vx = attrib.vertices[3*(size_t)idx.vertex_index+0];
-            tinyobj::real_t vy = attrib.vertices[3*(size_t)idx.vertex_index+1];
-            tinyobj::real_t vz = attrib.vertices[3*(size_t)idx.vertex_index+2];
-            finalVertices[vertCount] = vx; finalVertices[(size_t)vertCount+1] = vy; finalVertices[(size_t)vertCount+2] = vz;
-            vertCount += 3;
-            tinyobj::real_t nx = attrib.normals[3*(size_t)idx.normal_index+0];
-            tinyobj::real_t ny = attrib.normals[3*(size_t)idx.normal_index+1];
-            tinyobj::real_t nz = attrib.normals[3*(size_t)idx.normal_index+2];
-            finalNormals[normalCount] = nx; finalNormals[(size_t)normalCount+1] = ny; finalNormals[(size_t)normalCount+2] = nz;
-            normalCount += 3;
-            tinyobj::real_t tx = attrib.texcoords[2*(size_t)idx.texcoord_index+0];
-            tinyobj::real_t ty = attrib.texcoords[2*(size_t)idx.texcoord_index+1];
-            finalTextCoords[textCoordCount] = tx; finalTextCoords[(size_t)textCoordCount+1] = ty;
-            textCoordCount += 2;
-            // Optional: vertex colors
-            // tinyobj::real_t red = attrib.colors[3*idx.vertex_index+0];
-            // tinyobj::real_t green = attrib.colors[3*idx.vertex_index+1];
-            // tinyobj::real_t blue = attrib.colors[3*idx.vertex_index+2];
-        }
-        index_offset += fv;
-    }
-    meshData->vertices = finalVertices;
-    meshData->textureCoordinates = finalTextCoords;
-    meshData->normals = finalNormals;
+    meshData->hasNormals = (header.flags & MESH_FILE_HAS_NORMALS) != 0;
+    meshData->hasTextureCoordinates = (header.flags & MESH_FILE_HAS_TEXTURE_COORDINATES) != 0;
+    meshData->numVertices = header.numVertices;
+    meshData->numIndices = header.numIndices;
+
+    std::vector<MeshFileMaterial> materials(header.numMaterials);
+    std::vector<MeshFileSubMesh> subMeshes(header.numSubMeshes);
+    meshData->vertices.resize(header.numVertices);
+    _copyMeshFileSection(buffer, header.materialsOffset, materials);
+    _copyMeshFileSection(buffer, header.subMeshesOffset, subMeshes);
+    _copyMeshFileSection(buffer, header.verticesOffset, meshData->vertices);
+    if (isIndices16) {
+        meshData->indices16.resize(header.numIndices);
+        _copyMeshFileSection(buffer, header.indicesOffset, meshData->indices16);
+    } else {
+        meshData->indices32.resize(header.numIndices);
+        _copyMeshFileSection(buffer, header.indicesOffset, meshData->indices32);
+    }
+    std::vector<uint8_t>().swap(buffer);
+
+    std::string directory = path.substr(0, path.find_last_of('/') + 1);
+    for (MeshFileMaterial& fileMaterial : materials) {
+        // Don't trust the terminators
+        fileMaterial.name[sizeof(fileMaterial.name) - 1] = '\0';
+        fileMaterial.diffuseTexture[sizeof(fileMaterial.diffuseTexture) - 1] = '\0';
+
+        MeshMaterial material;
+        material.name = fileMaterial.name;
+        memcpy(material.diffuse, fileMaterial.diffuse, sizeof(material.diffuse));
+        material.opacity = fileMaterial.opacity;
+        if (fileMaterial.diffuseTexture[0] != '\0') {
+            material.diffuseTextureName = fileMaterial.diffuseTexture;
+            material.diffuseTexturePath = directory + material.diffuseTextureName;
+        }
+        meshData->materials.push_back(material);
+    }
+    for (const MeshFileSubMesh& fileSubMesh : subMeshes) {
+        SubMesh subMesh;
+        subMesh.materialIndex = fileSubMesh.materialIndex;
+        subMesh.vertexOffset = fileSubMesh.vertexOffset;
+        subMesh.numVertices = fileSubMesh.numVertices;
+        subMesh.indexOffset = fileSubMesh.indexOffset;
+        subMesh.numIndices = fileSubMesh.numIndices;
+        if (subMesh.materialIndex >= (int)header.numMaterials ||
+            subMesh.vertexOffset + subMesh.numVertices > header.numVertices ||
+            subMesh.indexOffset + subMesh.numIndices > header.numIndices) {
+            ERROR_PRINTLN("Corrupt sub mesh in glexmesh file: %s", platformPath.c_str());
+            delete meshData;
+            return NULL;
+        }
+        // Indices count from the sub mesh's first vertex, so this also keeps them below numVertices
+        if (!(isIndices16 ? _isSubMeshIndicesValid(meshData->indices16, subMesh) : _isSubMeshIndicesValid(meshData->indices32, subMesh))) {
+            ERROR_PRINTLN("Index out of range in glexmesh file: %s", platformPath.c_str());
+            delete meshData;
+            return NULL;
+        }
+        meshData->subMeshes.push_back(subMesh);
+    }
+
+    memcpy(meshData->boundingBox.min, header.boundingBoxMin, sizeof(header.boundingBoxMin));
+    memcpy(meshData->boundingBox.max, header.boundingBoxMax, sizeof(header.boundingBoxMax));
+    memcpy(meshData->boundingSphere.center, header.boundingSphereCenter, sizeof(header.boundingSphereCenter));
+    meshData->boundingSphere.radius = header.boundingSphereRadius;
+
+    DEBUG_PRINTLN("Finished loading binary mesh %s (%d vertices, %d indices, %d sub meshes)", platformPath.c_str(), (int)meshData->numVertices, (int)meshData->numIndices, (int)meshData->subMeshes.size());
     return meshData;
-}
\ No newline at end of file
+}
+
+bool MeshLoader::saveBinaryMesh(const MeshData* meshData, std::string path) {
+    const bool isIndices16 = meshData->isIndices16();
+
+    std::vector<MeshFileMaterial> materials(meshData->materials.size());
+    for (size_t i = 0; i < materials.size(); i++) {
+        const MeshMaterial& material = meshData->materials[i];
+        MeshFileMaterial& fileMaterial = materials[i];
+        memset(&fileMaterial, 0, sizeof(fileMaterial));
+
+        // Stored as the material named it, so the texture is expected at the same place relative
+        // to the .glexmesh file as it was to the OBJ
+        const std::string& texture = material.diffuseTextureName;
+        if (material.name.size() >= sizeof(fileMaterial.name) || texture.size() >= sizeof(fileMaterial.diffuseTexture)) {
+            ERROR_PRINTLN("Material name or texture path too long for glexmesh: %s", material.name.c_str());
+            return false;
+        }
+        memcpy(fileMaterial.name, material.name.c_str(), material.name.size());
+        memcpy(fileMaterial.diffuseTexture, texture.c_str(), texture.size());
+        memcpy(fileMaterial.diffuse, material.diffuse, sizeof(fileMaterial.diffuse));
+        fileMaterial.opacity = material.opacity;
+    }
+
+    std::vector<MeshFileSubMesh> subMeshes(meshData->subMeshes.size());
+    for (size_t i = 0; i < subMeshes.size(); i++) {
+        const SubMesh& subMesh = meshData->subMeshes[i];
+        subMeshes[i].materialIndex = subMesh.materialIndex;
+        subMeshes[i].vertexOffset = (uint32_t)subMesh.vertexOffset;
+        subMeshes[i].numVertices = (uint32_t)subMesh.numVertices;
+        subMeshes[i].indexOffset = (uint32_t)subMesh.indexOffset;
+        subMeshes[i].numIndices = (uint32_t)subMesh.numIndices;
+    }
+
+    MeshFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, MESH_FILE_MAGIC, sizeof(header.magic));
+    header.version = MESH_FILE_VERSION;
+    header.flags = (meshData->hasNormals ? MESH_FILE_HAS_NORMALS : 0) |
+                   (meshData->hasTextureCoordinates ? MESH_FILE_HAS_TEXTURE_COORDINATES : 0) |
+                   (isIndices16 ? MESH_FILE_INDICES_16 : 0);
+    header.numMaterials = (uint32_t)materials.size();
+    header.numSubMeshes = (uint32_t)subMeshes.size();
+    header.numVertices = (uint32_t)meshData->vertices.size();
+    header.numIndices = (uint32_t)meshData->numIndices;
+    memcpy(header.boundingBoxMin, meshData->boundingBox.min, sizeof(header.boundingBoxMin));
+    memcpy(header.boundingBoxMax, meshData->boundingBox.max, sizeof(header.boundingBoxMax));
+    memcpy(header.boundingSphereCenter, meshData->boundingSphere.center, sizeof(header.boundingSphereCenter));
+    header.boundingSphereRadius = meshData->boundingSphere.radius;
+
+    const void* indices = isIndices16 ? (const void*)meshData->indices16.data() : (const void*)meshData->indices32.data();
+    const size_t indicesSize = meshData->numIndices * (isIndices16 ? sizeof(uint16_t) : sizeof(uint32_t));
+
+    header.materialsOffset = _alignMeshFileOffset(sizeof(header));
+    header.subMeshesOffset = _alignMeshFileOffset(header.materialsOffset + materials.size() * sizeof(MeshFileMaterial));
+    header.verticesOffset = _alignMeshFileOffset(header.subMeshesOffset + subMeshes.size() * sizeof(MeshFileSubMesh));
+    header.indicesOffset = _alignMeshFileOffset(header.verticesOffset + meshData->vertices.size() * sizeof(MeshVertex));
+    header.fileSize = _alignMeshFileOffset(header.indicesOffset + indicesSize);
+
+    // Assemble the whole file, the gaps between the sections stay zeroed
+    std::vector<uint8_t> buffer(header.fileSize, 0);
+    memcpy(&buffer[0], &header, sizeof(header));
+    if (!materials.empty()) {
+        memcpy(&buffer[header.materialsOffset], materials.data(), materials.size() * sizeof(MeshFileMaterial));
+    }
+    if (!subMeshes.empty()) {
+        memcpy(&buffer[header.subMeshesOffset], subMeshes.data(), subMeshes.size() * sizeof(MeshFileSubMesh));
+    }
+    if (!meshData->vertices.empty()) {
+        memcpy(&buffer[header.verticesOffset], meshData->vertices.data(), meshData->vertices.size() * sizeof(MeshVertex));
+    }
+    if (indicesSize > 0) {
+        memcpy(&buffer[header.indicesOffset], indices, indicesSize);
+    }
+
+    FILE* file = fopen(path.c_str(), "wb");
+    if (file == NULL) {
+        ERROR_PRINTLN("Couldn't create mesh file %s", path.c_str());
+        return false;
+    }
+    bool success = fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+    success = fclose(file) == 0 && success;
+    if (!success) {
+        ERROR_PRINTLN("Couldn't write mesh file %s", path.c_str());
+    }
+    return success;
+}
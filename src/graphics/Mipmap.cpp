@@ -0,0 +1,182 @@
+#include "glex/graphics/Mipmap.h"
+#include "glex/graphics/Texture.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(__SSE2__) && !defined(DREAMCAST)
+#include <emmintrin.h>
+#endif
+
+// Box filters 4 RGBA pixels per channel with exact rounding, two channels at a time in 16 bit
+// fields of a 32 bit word (the sums fit in 10 bits)
+static inline uint32_t _averageWords(uint32_t a, uint32_t b, uint32_t c, uint32_t d) {
+    uint32_t even = (a & 0x00FF00FF) + (b & 0x00FF00FF) + (c & 0x00FF00FF) + (d & 0x00FF00FF) + 0x00020002;
+    uint32_t odd = ((a >> 8) & 0x00FF00FF) + ((b >> 8) & 0x00FF00FF) + ((c >> 8) & 0x00FF00FF) + ((d >> 8) & 0x00FF00FF) + 0x00020002;
+    return ((even >> 2) & 0x00FF00FF) | (((odd >> 2) & 0x00FF00FF) << 8);
+}
+
+static void _downsampleBoxRow(const unsigned char* row0, const unsigned char* row1, int components,
+                              GLsizei width, GLsizei outputWidth, unsigned char* output) {
+    GLsizei x = 0;
+    if (components == 4 && width % 2 == 0) {
+#if defined(__SSE2__) && !defined(DREAMCAST)
+        // 8 source pixels to 4 at a time: sum the rows in 16 bits, then each pair of pixels
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i rounding = _mm_set1_epi16(2);
+        for (; x + 4 <= outputWidth; x += 4) {
+            __m128i top0 = _mm_loadu_si128((const __m128i*)(row0 + x * 8));
+            __m128i top1 = _mm_loadu_si128((const __m128i*)(row0 + x * 8 + 16));
+            __m128i bottom0 = _mm_loadu_si128((const __m128i*)(row1 + x * 8));
+            __m128i bottom1 = _mm_loadu_si128((const __m128i*)(row1 + x * 8 + 16));
+
+            // Each holds two source pixels, 4 channels each
+            __m128i sum0 = _mm_add_epi16(_mm_unpacklo_epi8(top0, zero), _mm_unpacklo_epi8(bottom0, zero));
+            __m128i sum1 = _mm_add_epi16(_mm_unpackhi_epi8(top0, zero), _mm_unpackhi_epi8(bottom0, zero));
+            __m128i sum2 = _mm_add_epi16(_mm_unpacklo_epi8(top1, zero), _mm_unpacklo_epi8(bottom1, zero));
+            __m128i sum3 = _mm_add_epi16(_mm_unpackhi_epi8(top1, zero), _mm_unpackhi_epi8(bottom1, zero));
+
+            // Add the second pixel of each pair to the first, then gather the first pixels
+            sum0 = _mm_add_epi16(sum0, _mm_srli_si128(sum0, 8));
+            sum1 = _mm_add_epi16(sum1, _mm_srli_si128(sum1, 8));
+            sum2 = _mm_add_epi16(sum2, _mm_srli_si128(sum2, 8));
+            sum3 = _mm_add_epi16(sum3, _mm_srli_si128(sum3, 8));
+            __m128i low = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(sum0, sum1), rounding), 2);
+            __m128i high = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(sum2, sum3), rounding), 2);
+            _mm_storeu_si128((__m128i*)(output + x * 4), _mm_packus_epi16(low, high));
+        }
+#else
+        // Rows of RGBA pixels start word aligned as long as the image does
+        if ((((uintptr_t)row0 | (uintptr_t)row1 | (uintptr_t)output) & 3) == 0) {
+            const uint32_t* top = (const uint32_t*)row0;
+            const uint32_t* bottom = (const uint32_t*)row1;
+            uint32_t* output32 = (uint32_t*)output;
+            for (; x + 2 <= outputWidth; x += 2) {
+                output32[x]     = _averageWords(top[x * 2],     top[x * 2 + 1], bottom[x * 2],     bottom[x * 2 + 1]);
+                output32[x + 1] = _averageWords(top[x * 2 + 2], top[x * 2 + 3], bottom[x * 2 + 2], bottom[x * 2 + 3]);
+            }
+        }
+#endif
+    }
+
+    // Odd widths reuse the last column
+    for (; x < outputWidth; x++) {
+        GLsizei x0 = x * 2;
+        GLsizei x1 = x0 + 1 < width ? x0 + 1 : width - 1;
+        for (int channel = 0; channel < components; channel++) {
+            unsigned sum = row0[x0 * components + channel] + row0[x1 * components + channel] +
+                           row1[x0 * components + channel] + row1[x1 * components + channel];
+            output[x * components + channel] = (unsigned char)((sum + 2) >> 2);
+        }
+    }
+}
+
+void glex::downsampleBox(const unsigned char* pixels, int components, GLsizei width, GLsizei height, unsigned char* output) {
+    GLsizei outputWidth = mipmapSize(width, 1);
+    GLsizei outputHeight = mipmapSize(height, 1);
+    size_t rowSize = (size_t)width * components;
+    for (GLsizei y = 0; y < outputHeight; y++) {
+        GLsizei y0 = y * 2;
+        GLsizei y1 = y0 + 1 < height ? y0 + 1 : height - 1;
+        _downsampleBoxRow(pixels + y0 * rowSize, pixels + y1 * rowSize, components, width, outputWidth,
+                          output + (size_t)y * outputWidth * components);
+    }
+}
+
+// Kaiser window parameters, in output texels: the filter reaches 2 output (4 source) texels out
+// on each side
+static const float _kaiserRadius = 2.0f;
+static const float _kaiserAlpha = 4.0f;
+static const int _kaiserTaps = 8;
+
+static float _besselI0(float x) {
+    // Power series, converges quickly for the alphas used here
+    float sum = 1.0f;
+    float term = 1.0f;
+    for (int k = 1; k < 20; k++) {
+        term *= (x / (2.0f * k)) * (x / (2.0f * k));
+        sum += term;
+    }
+    return sum;
+}
+
+// Weights of the source texels 2i - 3 ... 2i + 4 around output texel i, normalized
+static void _kaiserWeights(float weights[_kaiserTaps]) {
+    const float pi = 3.14159265358979f;
+    float total = 0;
+    for (int tap = 0; tap < _kaiserTaps; tap++) {
+        // Distance from the output texel's center, in output texels
+        float x = (tap - _kaiserTaps / 2 + 0.5f) * 0.5f;
+        float sinc = x == 0 ? 1.0f : sinf(pi * x) / (pi * x);
+        float window = x / _kaiserRadius;
+        float kaiser = window * window < 1 ? _besselI0(_kaiserAlpha * sqrtf(1 - window * window)) / _besselI0(_kaiserAlpha) : 0;
+        weights[tap] = sinc * kaiser;
+        total += weights[tap];
+    }
+    for (int tap = 0; tap < _kaiserTaps; tap++) {
+        weights[tap] /= total;
+    }
+}
+
+void glex::downsampleKaiser(const unsigned char* pixels, int components, GLsizei width, GLsizei height, unsigned char* output) {
+    GLsizei outputWidth = mipmapSize(width, 1);
+    GLsizei outputHeight = mipmapSize(height, 1);
+    float weights[_kaiserTaps];
+    _kaiserWeights(weights);
+
+    // Separable: filter the rows into floats, then the columns. Edges clamp.
+    std::vector<float> rows((size_t)height * outputWidth * components);
+    for (GLsizei y = 0; y < height; y++) {
+        const unsigned char* source = pixels + (size_t)y * width * components;
+        float* destination = &rows[(size_t)y * outputWidth * components];
+        for (GLsizei x = 0; x < outputWidth; x++) {
+            for (int channel = 0; channel < components; channel++) {
+                float sum = 0;
+                for (int tap = 0; tap < _kaiserTaps; tap++) {
+                    GLsizei sourceX = x * 2 + tap - _kaiserTaps / 2 + 1;
+                    sourceX = sourceX < 0 ? 0 : (sourceX >= width ? width - 1 : sourceX);
+                    sum += weights[tap] * source[sourceX * components + channel];
+                }
+                destination[x * components + channel] = sum;
+            }
+        }
+    }
+
+    for (GLsizei y = 0; y < outputHeight; y++) {
+        unsigned char* destination = output + (size_t)y * outputWidth * components;
+        for (GLsizei i = 0; i < outputWidth * components; i++) {
+            float sum = 0;
+            for (int tap = 0; tap < _kaiserTaps; tap++) {
+                GLsizei sourceY = y * 2 + tap - _kaiserTaps / 2 + 1;
+                sourceY = sourceY < 0 ? 0 : (sourceY >= height ? height - 1 : sourceY);
+                sum += weights[tap] * rows[(size_t)sourceY * outputWidth * components + i];
+            }
+            // The negative lobes can overshoot
+            sum += 0.5f;
+            destination[i] = sum <= 0 ? 0 : (sum >= 255 ? 255 : (unsigned char)sum);
+        }
+    }
+}
+
+void glex::generateMipmaps(TextureImage& image, MipmapFilter filter) {
+    image.mipmaps.clear();
+    if (filter == MipmapFilter::None) {
+        return;
+    }
+
+    const unsigned char* previous = image.pixels.data();
+    for (size_t level = 1; mipmapSize(image.width, level - 1) > 1 || mipmapSize(image.height, level - 1) > 1; level++) {
+        GLsizei width = mipmapSize(image.width, level - 1);
+        GLsizei height = mipmapSize(image.height, level - 1);
+        std::vector<unsigned char> pixels((size_t)mipmapSize(width, 1) * mipmapSize(height, 1) * image.components);
+        if (filter == MipmapFilter::Kaiser) {
+            downsampleKaiser(previous, image.components, width, height, pixels.data());
+        } else {
+            downsampleBox(previous, image.components, width, height, pixels.data());
+        }
+        image.mipmaps.push_back(std::move(pixels));
+        previous = image.mipmaps.back().data();
+    }
+}
@@ -0,0 +1,225 @@
+#ifdef GLFW
+
+#include "glex/graphics/ModernRenderBackend.h"
+#include "glex/graphics/Geometry.h"
+#include "glex/common/log.h"
+
+#include <cstdint>
+
+// Attribute locations shared by all of the built-in shaders
+static constexpr GLuint ATTRIBUTE_POSITION = 0;
+static constexpr GLuint ATTRIBUTE_TEX_COORD = 1;
+static constexpr GLuint ATTRIBUTE_COLOR = 2;
+
+// The compatibility profile gives the shaders the fixed function matrices, so everything that
+// sets up transforms with the matrix stack works the same with either backend
+static const char* VERTEX_SHADER = R"(
+#version 330 compatibility
+layout(location = 0) in vec3 position;
+layout(location = 1) in vec2 texCoord;
+layout(location = 2) in vec4 color;
+out vec2 fragmentTexCoord;
+out vec4 fragmentColor;
+
+void main() {
+    gl_Position = gl_ModelViewProjectionMatrix * vec4(position, 1.0);
+    fragmentTexCoord = texCoord;
+    fragmentColor = color;
+}
+)";
+
+// Matches GL_MODULATE with lighting disabled
+static const char* TEXTURE_FRAGMENT_SHADER = R"(
+#version 330 compatibility
+in vec2 fragmentTexCoord;
+in vec4 fragmentColor;
+uniform sampler2D textureSampler;
+layout(location = 0) out vec4 outputColor;
+
+void main() {
+    outputColor = fragmentColor * texture(textureSampler, fragmentTexCoord);
+}
+)";
+
+static const char* COLOR_FRAGMENT_SHADER = R"(
+#version 330 compatibility
+in vec2 fragmentTexCoord;
+in vec4 fragmentColor;
+layout(location = 0) out vec4 outputColor;
+
+void main() {
+    outputColor = fragmentColor;
+}
+)";
+
+bool ModernRenderBackend::initialize() {
+    if (!GLAD_GL_VERSION_3_3) {
+        return false;
+    }
+    if (_colorProgram != 0) {
+        return true;
+    }
+
+    _colorProgram = _createProgram(VERTEX_SHADER, COLOR_FRAGMENT_SHADER);
+    _textureProgram = _createProgram(VERTEX_SHADER, TEXTURE_FRAGMENT_SHADER);
+    if (_colorProgram == 0 || _textureProgram == 0) {
+        return false;
+    }
+
+    glUseProgram(_textureProgram);
+    glUniform1i(glGetUniformLocation(_textureProgram, "textureSampler"), 0);
+    glUseProgram(0);
+    return true;
+}
+
+void ModernRenderBackend::drawGeometry(Geometry& geometry) {
+    if (geometry.isDirty || geometry.vertexArray == 0) {
+        _upload(geometry);
+    }
+
+    // Pick the shader matching the state set by RenderState
+    GLuint program = GLStateCache::isEnabled(GL_TEXTURE_2D) ? _textureProgram : _colorProgram;
+    glUseProgram(program);
+    if (geometry.layout.colorOffset < 0) {
+        // Generic attribute values aren't part of the vertex array, so this applies to any geometry without colors.
+        // Geometry with colors gets alpha 1 from the 3 component attribute, same as glColorPointer.
+        glVertexAttrib4fv(ATTRIBUTE_COLOR, _color);
+    }
+
+    glBindVertexArray(geometry.vertexArray);
+    if (geometry.indices != nullptr) {
+        glDrawElements(geometry.mode, geometry.indexCount, geometry.indexType, nullptr);
+    } else {
+        glDrawArrays(geometry.mode, 0, geometry.vertexCount);
+    }
+
+    // Leave the default vertex array and no program bound, so client array drawing (and the
+    // client state tracked by GLStateCache) keeps working
+    glBindVertexArray(0);
+    glUseProgram(0);
+}
+
+void ModernRenderBackend::releaseGeometry(Geometry& geometry) {
+    if (geometry.vertexArray != 0) {
+        glDeleteVertexArrays(1, &geometry.vertexArray);
+    }
+    if (geometry.vertexBuffer != 0) {
+        glDeleteBuffers(1, &geometry.vertexBuffer);
+    }
+    if (geometry.indexBuffer != 0) {
+        glDeleteBuffers(1, &geometry.indexBuffer);
+    }
+    geometry.vertexArray = 0;
+    geometry.vertexBuffer = 0;
+    geometry.indexBuffer = 0;
+}
+
+void ModernRenderBackend::setColor(GLfloat r, GLfloat g, GLfloat b, GLfloat a) {
+    _color[0] = r;
+    _color[1] = g;
+    _color[2] = b;
+    _color[3] = a;
+
+    // Also set it for anything still drawn with client arrays
+    glColor4f(r, g, b, a);
+}
+
+void ModernRenderBackend::configureAlphaTexture() {
+    // The fixed function pipeline treats GL_ALPHA textures as white, shaders see them as black
+    const GLint swizzle[] = { GL_ONE, GL_ONE, GL_ONE, GL_ALPHA };
+    glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+}
+
+void ModernRenderBackend::_upload(Geometry& geometry) {
+    // Geometry that keeps changing (i.e. Text) is hinted as dynamic after its first upload
+    const bool isFirstUpload = geometry.vertexArray == 0;
+    const GLenum usage = isFirstUpload ? GL_STATIC_DRAW : GL_DYNAMIC_DRAW;
+    if (isFirstUpload) {
+        glGenVertexArrays(1, &geometry.vertexArray);
+        glGenBuffers(1, &geometry.vertexBuffer);
+    }
+    glBindVertexArray(geometry.vertexArray);
+
+    const VertexLayout& layout = geometry.layout;
+    glBindBuffer(GL_ARRAY_BUFFER, geometry.vertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)geometry.vertexCount * layout.stride, geometry.vertices, usage);
+
+    // Vertex attribute offsets are relative to the bound buffer
+    glEnableVertexAttribArray(ATTRIBUTE_POSITION);
+    glVertexAttribPointer(ATTRIBUTE_POSITION, 3, GL_FLOAT, GL_FALSE, layout.stride, (const void*)(uintptr_t)layout.positionOffset);
+    if (layout.texCoordOffset >= 0) {
+        glEnableVertexAttribArray(ATTRIBUTE_TEX_COORD);
+        glVertexAttribPointer(ATTRIBUTE_TEX_COORD, 2, GL_FLOAT, GL_FALSE, layout.stride, (const void*)(uintptr_t)layout.texCoordOffset);
+    } else {
+        glDisableVertexAttribArray(ATTRIBUTE_TEX_COORD);
+    }
+    if (layout.colorOffset >= 0) {
+        glEnableVertexAttribArray(ATTRIBUTE_COLOR);
+        glVertexAttribPointer(ATTRIBUTE_COLOR, 3, GL_FLOAT, GL_FALSE, layout.stride, (const void*)(uintptr_t)layout.colorOffset);
+    } else {
+        glDisableVertexAttribArray(ATTRIBUTE_COLOR);
+    }
+    // Normals aren't uploaded since lighting is disabled everywhere, same as the fixed function path
+
+    if (geometry.indices != nullptr) {
+        GLsizeiptr indexSize = geometry.indexType == GL_UNSIGNED_INT ? 4 : (geometry.indexType == GL_UNSIGNED_SHORT ? 2 : 1);
+        if (geometry.indexBuffer == 0) {
+            glGenBuffers(1, &geometry.indexBuffer);
+        }
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, geometry.indexBuffer);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)geometry.indexCount * indexSize, geometry.indices, usage);
+    }
+
+    // The element buffer binding belongs to the vertex array, but the array buffer binding doesn't
+    // and would break client array drawing if left bound
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    geometry.isDirty = false;
+}
+
+GLuint ModernRenderBackend::_createProgram(const char* vertexSource, const char* fragmentSource) {
+    GLuint vertexShader = _compileShader(GL_VERTEX_SHADER, vertexSource);
+    GLuint fragmentShader = _compileShader(GL_FRAGMENT_SHADER, fragmentSource);
+    if (vertexShader == 0 || fragmentShader == 0) {
+        glDeleteShader(vertexShader);
+        glDeleteShader(fragmentShader);
+        return 0;
+    }
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    GLint isLinked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &isLinked);
+    if (!isLinked) {
+        char log[512];
+        glGetProgramInfoLog(program, sizeof(log), NULL, log);
+        ERROR_PRINTLN("Failed to link shader program: %s", log);
+        glDeleteProgram(program);
+        return 0;
+    }
+    return program;
+}
+
+GLuint ModernRenderBackend::_compileShader(GLenum type, const char* source) {
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+
+    GLint isCompiled = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &isCompiled);
+    if (!isCompiled) {
+        char log[512];
+        glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+        ERROR_PRINTLN("Failed to compile shader: %s", log);
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+#endif
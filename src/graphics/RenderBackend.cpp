@@ -0,0 +1,36 @@
+#include "glex/graphics/RenderBackend.h"
+#include "glex/graphics/FixedFunctionRenderBackend.h"
+#include "glex/common/log.h"
+
+#ifdef GLFW
+#include "glex/graphics/ModernRenderBackend.h"
+#endif
+
+static FixedFunctionRenderBackend _fixedFunctionBackend;
+#ifdef GLFW
+static ModernRenderBackend _modernBackend;
+#endif
+
+RenderBackend* RenderBackend::_current = &_fixedFunctionBackend;
+
+RenderBackend& RenderBackend::current() {
+    return *_current;
+}
+
+RenderBackend::Type RenderBackend::select(Type type) {
+    _current = &_fixedFunctionBackend;
+#ifdef GLFW
+    if (type == Type::Modern) {
+        if (_modernBackend.initialize()) {
+            _current = &_modernBackend;
+        } else {
+            ERROR_PRINTLN("Failed to initialize the %s render backend, falling back to %s", _modernBackend.name(), _fixedFunctionBackend.name());
+        }
+    }
+#else
+    (void)type; // Only the fixed function backend exists
+#endif
+    _current->initialize();
+    DEBUG_PRINTLN("Using the %s render backend", _current->name());
+    return _current->type();
+}
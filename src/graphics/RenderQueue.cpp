@@ -0,0 +1,147 @@
+#include "glex/graphics/RenderQueue.h"
+#include "glex/graphics/Image.h"
+#include "glex/Application.h"
+#include "glex/common/frustum.h"
+#include "glex/common/log.h"
+
+#include <algorithm>
+
+// Sort key layout (most significant bits first):
+//   63-48  layer (projection) index
+//   47     blend
+//   46     depth test
+//   45     cull face
+//   44-5   opaque:  texture id (24 bits), then depth front to back (16 bits)
+//          blended: depth back to front (16 bits), then texture id (24 bits)
+static constexpr int KEY_LAYER_SHIFT      = 48;
+static constexpr int KEY_BLEND_SHIFT      = 47;
+static constexpr int KEY_DEPTH_TEST_SHIFT = 46;
+static constexpr int KEY_CULL_FACE_SHIFT  = 45;
+static constexpr int KEY_HIGH_SHIFT       = 21;
+static constexpr int KEY_LOW_SHIFT        = 5;
+static constexpr uint64_t KEY_TEXTURE_MASK = 0xFFFFFF;
+static constexpr uint64_t KEY_DEPTH_MAX    = 0xFFFF;
+static constexpr size_t MAX_LAYERS = 0xFFFF;
+
+float RenderQueue::depthForOrthoZ(float z) {
+    // Z_HUD is the nearest and Z_BACKGROUND the farthest
+    return (Image::Z_HUD - z) / (Image::Z_HUD - Image::Z_BACKGROUND);
+}
+
+void RenderQueue::setFrustum() {
+    _addLayer(Projection::Frustum, 1.0);
+    // Drawables submitted after this are culled against the camera the layer will be drawn with,
+    // not whatever projection the last flush ended on
+    Frustum::restoreCurrent();
+}
+
+void RenderQueue::setOrtho(float scale) {
+    _addLayer(Projection::Ortho, scale);
+    Frustum::clearCurrent();
+}
+
+void RenderQueue::_addLayer(Projection projection, float orthoScale) {
+    // Reuse the last layer if nothing was submitted to it
+    if (!_layers.empty() && (_commands.empty() || (_commands.back().key >> KEY_LAYER_SHIFT) != _layers.size() - 1)) {
+        _layers.back() = { projection, orthoScale };
+        return;
+    }
+
+    if (_layers.size() >= MAX_LAYERS) {
+        ERROR_PRINTLN("ERROR: RenderQueue supports at most %d projection changes per frame", (int)MAX_LAYERS);
+        return;
+    }
+    _layers.push_back({ projection, orthoScale });
+}
+
+uint64_t RenderQueue::_makeKey(uint16_t layer, const RenderState& state, float depth) {
+    depth = std::min(std::max(depth, 0.0f), 1.0f);
+    uint64_t quantizedDepth = (uint64_t)(depth * (float)KEY_DEPTH_MAX);
+    uint64_t texture = (uint64_t)state.textureId & KEY_TEXTURE_MASK;
+
+    uint64_t key = (uint64_t)layer << KEY_LAYER_SHIFT;
+    key |= (uint64_t)state.blend << KEY_BLEND_SHIFT;
+    key |= (uint64_t)state.depthTest << KEY_DEPTH_TEST_SHIFT;
+    key |= (uint64_t)state.cullFace << KEY_CULL_FACE_SHIFT;
+    if (state.blend) {
+        // Back to front so blending is correct, then by texture
+        key |= (KEY_DEPTH_MAX - quantizedDepth) << (KEY_HIGH_SHIFT + 8);
+        key |= texture << KEY_LOW_SHIFT;
+    } else {
+        // By texture to minimize binds, then front to back to minimize overdraw
+        key |= texture << KEY_HIGH_SHIFT;
+        key |= quantizedDepth << KEY_LOW_SHIFT;
+    }
+    return key;
+}
+
+void RenderQueue::submit(const RenderState& state, float depth, void* drawable, DrawFunction drawFunction) {
+    _addCommand(state, depth, drawable, drawFunction, nullptr);
+}
+
+void RenderQueue::submit(const RenderState& state, float depth, const Image& sprite) {
+    _addCommand(state, depth, nullptr, nullptr, &sprite);
+}
+
+void RenderQueue::_addCommand(const RenderState& state, float depth, void* drawable, DrawFunction drawFunction, const Image* sprite) {
+    if (_layers.empty()) {
+        _layers.push_back({ Projection::Current, 1.0 });
+    }
+    uint16_t layer = (uint16_t)(_layers.size() - 1);
+    _commands.push_back({ _makeKey(layer, state, depth), state, drawable, drawFunction, sprite });
+}
+
+void RenderQueue::flush(Application& app) {
+    _lastStateChanges = 0;
+    uint32_t issuedCallsBefore = GLStateCache::issuedCalls();
+    if (_commands.empty()) {
+        _layers.clear();
+        return;
+    }
+
+    // Stable so that drawables with identical keys keep their submission order
+    std::stable_sort(_commands.begin(), _commands.end(), [](const Command& lhs, const Command& rhs) {
+        return lhs.key < rhs.key;
+    });
+
+    Layer currentProjection = { Projection::Current, 1.0 };
+    size_t currentLayer = MAX_LAYERS;
+    for (const Command& command : _commands) {
+        // Switch projections when entering a new layer
+        size_t layerIndex = (size_t)(command.key >> KEY_LAYER_SHIFT);
+        if (layerIndex != currentLayer) {
+            // Sprites from the previous layer must be drawn with its projection
+            _spriteBatch.draw();
+
+            currentLayer = layerIndex;
+            const Layer& layer = _layers[layerIndex];
+            bool isSameProjection = layer.projection == currentProjection.projection &&
+                                    (layer.projection != Projection::Ortho || layer.orthoScale == currentProjection.orthoScale);
+            if (layer.projection != Projection::Current && !isSameProjection) {
+                if (layer.projection == Projection::Frustum) {
+                    app.reshapeFrustum();
+                } else {
+                    app.reshapeOrtho(layer.orthoScale);
+                }
+                currentProjection = layer;
+                _lastStateChanges++;
+            }
+        }
+
+        // Consecutive Images are collected and drawn together as soon as something else comes up
+        if (command.sprite != nullptr) {
+            _spriteBatch.add(*command.sprite);
+            continue;
+        }
+        _spriteBatch.draw();
+
+        // Sorting puts identical states next to each other, so the state cache skips almost everything
+        command.state.apply();
+        command.drawFunction(command.drawable);
+    }
+    _spriteBatch.draw();
+    _lastStateChanges += GLStateCache::issuedCalls() - issuedCallsBefore;
+
+    _commands.clear();
+    _layers.clear();
+}
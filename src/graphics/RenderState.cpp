@@ -0,0 +1,34 @@
+#include "glex/graphics/RenderState.h"
+
+void RenderState::apply() const {
+    GLStateCache::disable(GL_LIGHTING);
+
+    if (depthTest) {
+        GLStateCache::enable(GL_DEPTH_TEST);
+        GLStateCache::depthFunc(GL_LESS);
+    } else {
+        GLStateCache::disable(GL_DEPTH_TEST);
+    }
+
+    if (cullFace) {
+        GLStateCache::enable(GL_CULL_FACE);
+        GLStateCache::cullFace(GL_BACK);
+    } else {
+        GLStateCache::disable(GL_CULL_FACE);
+    }
+
+    if (blend) {
+        GLStateCache::enable(GL_BLEND);
+        GLStateCache::blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    } else {
+        GLStateCache::disable(GL_BLEND);
+    }
+
+    if (textureId != 0) {
+        GLStateCache::enable(GL_TEXTURE_2D);
+        GLStateCache::texEnvMode(GL_MODULATE);
+        GLStateCache::bindTexture(textureId);
+    } else {
+        GLStateCache::disable(GL_TEXTURE_2D);
+    }
+}
@@ -0,0 +1,98 @@
+#include "glex/graphics/SceneNode.h"
+
+#include <algorithm>
+
+SceneNode::~SceneNode() {
+    if (_parent != nullptr) {
+        _parent->removeChild(this);
+    }
+    for (SceneNode* child : _children) {
+        child->_parent = nullptr;
+        child->_setWorldDirty();
+    }
+}
+
+void SceneNode::setPosition(float x, float y, float z) {
+    _position[0] = x;
+    _position[1] = y;
+    _position[2] = z;
+    _setLocalDirty();
+}
+
+void SceneNode::setRotation(float x, float y, float z) {
+    _rotation[0] = x;
+    _rotation[1] = y;
+    _rotation[2] = z;
+    _setLocalDirty();
+}
+
+void SceneNode::setScale(float x, float y, float z) {
+    _scale[0] = x;
+    _scale[1] = y;
+    _scale[2] = z;
+    _setLocalDirty();
+}
+
+void SceneNode::addChild(SceneNode* child) {
+    if (child->_parent == this) {
+        return;
+    }
+    if (child->_parent != nullptr) {
+        child->_parent->removeChild(child);
+    }
+    child->_parent = this;
+    _children.push_back(child);
+    child->_setWorldDirty();
+}
+
+void SceneNode::removeChild(SceneNode* child) {
+    auto first = std::remove(_children.begin(), _children.end(), child);
+    if (first == _children.end()) {
+        return;
+    }
+    _children.erase(first, _children.end());
+    child->_parent = nullptr;
+    child->_setWorldDirty();
+}
+
+const Matrix4& SceneNode::localMatrix() {
+    if (_isLocalDirty) {
+        // translation * rotationZ * rotationY * rotationX * scale
+        _localMatrix = Matrix4::rotationZYX(_rotation[0], _rotation[1], _rotation[2]);
+        _localMatrix.scale(_scale[0], _scale[1], _scale[2]);
+        // The rotation has no translation, so translation * it only fills in the last column
+        _localMatrix.m[12] = _position[0];
+        _localMatrix.m[13] = _position[1];
+        _localMatrix.m[14] = _position[2];
+        _isLocalDirty = false;
+    }
+    return _localMatrix;
+}
+
+const Matrix4& SceneNode::worldMatrix() {
+    if (_isWorldDirty) {
+        if (_parent != nullptr) {
+            _worldMatrix = _parent->worldMatrix() * localMatrix();
+        } else {
+            _worldMatrix = localMatrix();
+        }
+        _isWorldDirty = false;
+    }
+    return _worldMatrix;
+}
+
+void SceneNode::_setLocalDirty() {
+    _isLocalDirty = true;
+    _setWorldDirty();
+}
+
+void SceneNode::_setWorldDirty() {
+    // If this node is already dirty, so is everything below it
+    if (_isWorldDirty) {
+        return;
+    }
+    _isWorldDirty = true;
+    for (SceneNode* child : _children) {
+        child->_setWorldDirty();
+    }
+}
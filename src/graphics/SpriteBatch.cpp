@@ -0,0 +1,117 @@
+#include "glex/graphics/SpriteBatch.h"
+#include "glex/graphics/Image.h"
+#include "glex/graphics/RenderBackend.h"
+#include "glex/graphics/RenderState.h"
+#include "glex/graphics/SceneNode.h"
+#include "glex/math/FastTrig.h"
+#include "glex/math/Matrix.h"
+
+void SpriteBatch::add(const Image& image) {
+    const float left = image.x;
+    const float right = image.x + image.width;
+    const float bottom = image.y - image.height;
+    const float top = image.y;
+    const UVRect& uv = image.uv;
+
+    // Same triangles and winding as Image::_drawList()
+    const GLfloat corners[VERTICES_PER_SPRITE][VERTEX_SIZE] = {
+        { left,  bottom, image.z, uv.s0, uv.t0 },  // Bottom Left
+        { right, bottom, image.z, uv.s1, uv.t0 },  // Bottom Right
+        { right, top,    image.z, uv.s1, uv.t1 },  // Top Right
+
+        { left,  bottom, image.z, uv.s0, uv.t0 },  // Bottom Left
+        { right, top,    image.z, uv.s1, uv.t1 },  // Top Right
+        { left,  top,    image.z, uv.s0, uv.t1 },  // Top Left
+    };
+
+    // Equivalent to glScalef(scale, scale, 1) * glRotatef(rotationY, 0, 1, 0) * glRotatef(rotationX, 1, 0, 0),
+    // skipping the trig entirely for the common case of an unrotated Image. An Image with a node
+    // uses the node's cached world matrix instead.
+    const Matrix4* world = image.node != nullptr ? &image.node->worldMatrix() : nullptr;
+    const bool isRotated = world == nullptr && (image.rotationX != 0 || image.rotationY != 0);
+    float sinX = 0, cosX = 1, sinY = 0, cosY = 1;
+    if (isRotated) {
+        glex::fastSinCos(image.rotationX, sinX, cosX);
+        glex::fastSinCos(image.rotationY, sinY, cosY);
+    }
+
+    const size_t start = _vertices.size();
+    _vertices.resize(start + VERTICES_PER_SPRITE * VERTEX_SIZE);
+    GLfloat* vertex = &_vertices[start];
+    for (size_t i = 0; i < VERTICES_PER_SPRITE; i++, vertex += VERTEX_SIZE) {
+        float vx = corners[i][0];
+        float vy = corners[i][1];
+        float vz = corners[i][2];
+        if (world != nullptr) {
+            Vector3 position = world->transformPoint(Vector3(vx, vy, vz));
+            vertex[0] = position.x;
+            vertex[1] = position.y;
+            vertex[2] = position.z;
+            vertex[3] = corners[i][3];
+            vertex[4] = corners[i][4];
+            continue;
+        }
+        if (isRotated) {
+            // Rotate around X
+            float ry = vy * cosX - vz * sinX;
+            float rz = vy * sinX + vz * cosX;
+            vy = ry;
+            vz = rz;
+            // Rotate around Y
+            float rx = vx * cosY + vz * sinY;
+            rz = -vx * sinY + vz * cosY;
+            vx = rx;
+            vz = rz;
+        }
+        vertex[0] = vx * image.scale;
+        vertex[1] = vy * image.scale;
+        vertex[2] = vz;
+        vertex[3] = corners[i][3];
+        vertex[4] = corners[i][4];
+    }
+
+    // Extend the current run if the texture is the same, otherwise start a new one
+    const GLuint textureId = image.texture->id;
+    if (!_runs.empty() && _runs.back().textureId == textureId) {
+        _runs.back().count += VERTICES_PER_SPRITE;
+    } else {
+        GLint first = (GLint)(start / VERTEX_SIZE);
+        _runs.push_back({ textureId, first, (GLsizei)VERTICES_PER_SPRITE });
+    }
+}
+
+void SpriteBatch::draw() {
+    _lastDrawCalls = 0;
+    if (_runs.empty()) {
+        return;
+    }
+
+    GLStateCache::enableClientState(GL_VERTEX_ARRAY);
+    GLStateCache::enableClientState(GL_TEXTURE_COORD_ARRAY);
+    GLStateCache::disableClientState(GL_NORMAL_ARRAY);
+    GLStateCache::disableClientState(GL_COLOR_ARRAY);
+
+    const GLsizei stride = (GLsizei)(VERTEX_SIZE * sizeof(GLfloat));
+    glVertexPointer(3, GL_FLOAT, stride, &_vertices[0]);
+    glTexCoordPointer(2, GL_FLOAT, stride, &_vertices[3]);
+
+    // Images are untinted, whatever color the last Text left behind
+    RenderBackend::current().setColor(1.0, 1.0, 1.0, 1.0);
+
+    RenderState state;
+    state.blend = true;
+    for (const Run& run : _runs) {
+        state.textureId = run.textureId;
+        state.apply();
+        glDrawArrays(GL_TRIANGLES, run.first, run.count);
+        _lastDrawCalls++;
+    }
+
+    clear();
+}
+
+void SpriteBatch::clear() {
+    // clear() keeps the capacity, so the buffers only grow to the largest frame
+    _vertices.clear();
+    _runs.clear();
+}
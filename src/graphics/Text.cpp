@@ -1,32 +1,47 @@
 #include "glex/graphics/Text.h"
+#include "glex/graphics/RenderQueue.h"
+#include "glex/graphics/SceneNode.h"
+#include "glex/graphics/FontTextureCache.h"
+#include "glex/graphics/RenderBackend.h"
 #include "glex/common/log.h"
+#include "glex/math/Matrix.h"
 #include "glex/fonts/arial_16pt.h"
 #include "glex/fonts/arial_28pt.h"
 #include "glex/fonts/arial_32pt.h"
 
 #include <cstdlib>
 
+// Glyph vertices are interleaved x, y, z, s, t
+static constexpr size_t VERTEX_SIZE = 5;
+static constexpr size_t VERTICES_PER_GLYPH = 6;
+
 // TODO: Fix font rendering (it has weird smaller ghost characters inside the normal characters)
 
 bool operator==(const FontColor& lhs, const FontColor& rhs) {
     return lhs.r == rhs.r && lhs.g == rhs.g && lhs.b == rhs.b;
 }
 
+const texture_font_t* textureFontForFace(FontFace face) {
+    // Fonts are loaded the first time they're requested
+    switch(face) {
+    case FontFace::arial_16:  return arial_16pt();
+    case FontFace::arial_28:  return arial_28pt();
+    case FontFace::arial_32:  return arial_32pt();
+    default:
+        DEBUG_PRINTLN("Unsupported font type");
+        exit(EXIT_FAILURE);
+    }
+}
+
 Text::~Text() {
     deleteTexture();
 }
 
 Text::Text(FontFace face_, std::string text_, FontColor color_, float x_, float y_, float z_, float windowScale_, float scale_, float kerning_) {
-    switch(face_) {
-    case FontFace::arial_16:  _font = arial_16pt; break;
-    case FontFace::arial_28:  _font = arial_28pt; break;
-    case FontFace::arial_32:  _font = arial_32pt; break;
-    default:
-        DEBUG_PRINTLN("Unsupported font type");
-        exit(EXIT_FAILURE);
-    }
+    _face = face_;
+    _font = textureFontForFace(face_);
 
-    _color = color_;
+    color = color_;
     text = text_;
     x = x_;
     y = y_;
@@ -37,121 +52,130 @@ Text::Text(FontFace face_, std::string text_, FontColor color_, float x_, float
 }
 
 void Text::createTexture() {
-    GLuint textureId;
-    glGenTextures(1, &textureId);
-    glBindTexture(GL_TEXTURE_2D, textureId);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-
-    // Optimization for white text
-    if (_color == FONT_COLOR_WHITE) {
-        // Use 8bit alpha only texture to save memory
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, (GLsizei)_font.tex_width, (GLsizei)_font.tex_height, 0, GL_ALPHA, GL_UNSIGNED_BYTE, &_font.tex_data[0]);
-    } else {
-        // Convert the texture data to 32bit RGBA
-        size_t currentSize = _font.tex_data.size();
-        size_t newSize = _font.tex_data.size() * 4;
-        uint8_t* rgbData = new uint8_t[newSize];
-        for (size_t i = 0; i < currentSize; i+=1) {
-            rgbData[(i*4)]   = _color.r;
-            rgbData[(i*4)+1] = _color.g;
-            rgbData[(i*4)+2] = _color.b;
-            rgbData[(i*4)+3] = _font.tex_data[i];
-        }
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, (GLsizei)_font.tex_width, (GLsizei)_font.tex_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, rgbData);
-    }
-
-    _texture.loadExisting((GLsizei)_font.tex_width, (GLsizei)_font.tex_height, textureId);
+    _texture = FontTextureCache::texture(_face, color);
 }
 
 void Text::deleteTexture() {
-    if (_texture.id != 0) {
-        glDeleteTextures(1, &_texture.id);
-        _texture.id = 0;
-    }
+    // The texture itself is deleted when the last Text using it lets go
+    _texture.reset();
 }
 
 void Text::draw() {
-    // Set OpenGL draw settings
-    glDisable(GL_LIGHTING);
-    glEnable(GL_DEPTH_TEST);
-    glDepthFunc(GL_LESS);
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     // Not sure if I need these or not
     //glAlphaFunc(GL_GREATER, 0.f);
     //glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_REPLACE);
+    _renderState().apply();
+    _drawTransformed();
+}
+
+void Text::submit(RenderQueue& queue) {
+    queue.submit(_renderState(), RenderQueue::depthForOrthoZ(z), this, [](void* text) {
+        static_cast<Text*>(text)->_drawTransformed();
+    });
+}
 
+RenderState Text::_renderState() {
+    RenderState state;
+    state.blend = true;
+    state.textureId = _texture ? _texture->id : 0;
+    return state;
+}
+
+void Text::_drawTransformed() {
     glPushMatrix();
 
-    // Perform scaling and rotation
-    //DEBUG_PRINTLN("Font scale: %f  windowScale: %f  xScale: %f  yScale: %f", scale, windowScale, scale * windowScale, scale * windowScale);
-    //glScalef(scale * windowScale, scale * windowScale, 1.0);
-    //glScalef(scale, scale, 1.0);
-    glScalef(scale, scale, 1.0);
-    glRotatef(rotationY, 0.0f, 1.0f, 0.0f);
-    glRotatef(rotationX, 1.0f, 0.0f, 0.0f);
+    if (node != nullptr) {
+        // The node's cached matrix, no trig per frame
+        glMultMatrixf(node->worldMatrix().data());
+    } else {
+        // Perform scaling and rotation
+        //DEBUG_PRINTLN("Font scale: %f  windowScale: %f  xScale: %f  yScale: %f", scale, windowScale, scale * windowScale, scale * windowScale);
+        //glScalef(scale * windowScale, scale * windowScale, 1.0);
+        //glScalef(scale, scale, 1.0);
+        glScalef(scale, scale, 1.0);
+        if (rotationX != 0 || rotationY != 0) {
+            glMultMatrixf(Matrix4::rotationZYX(rotationX, rotationY, 0.0f).data());
+        }
+    }
 
     _drawList();
 
-    glDisable(GL_BLEND);
+    glPopMatrix();
 }
 
-void Text::_drawList() {
-    glEnable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, _texture.id);
+bool Text::_isVerticesDirty() {
+    return !_isVerticesBuilt || _builtFont != _font || _builtX != x || _builtY != y || _builtZ != z || 
+           _builtKerning != kerning || _builtText != text;
+}
+
+void Text::_buildVertices() {
+    // clear() keeps the capacity, so changing the text only allocates when it gets longer
+    _vertices.clear();
+    _vertices.reserve(text.length() * VERTICES_PER_GLYPH * VERTEX_SIZE);
 
-    size_t i, j;
+    size_t i;
     float ix = x, iy = y;
     for(i = 0; i < text.length(); ++i) {
         // Find the glyph
-        texture_glyph_t* glyph = 0;
-        for(j = 0; j < _font.glyphs_count; ++j) {
-            if (_font.glyphs[j].charcode == text[i]) {
-                glyph = &_font.glyphs[j];
-                break;
-            }
-        }
+        const texture_glyph_t* glyph = texture_font_find_glyph(_font, (unsigned char)text[i]);
         if(!glyph) {
             continue;
         }
 
-        // // Try to dynamically add kerning (NOT WORKING)
-        //float k = 0;
-        // if (i > 0) {
-        //     for (j = 0; j < glyph->kerning_count; ++j) {
-        //         //DEBUG_PRINTLN("text[i]: %s text[i-1]: %s", &text[i], &text[i-1]);
-        //         if (glyph->kerning[j].codepoint == text[i-1]) {
-        //             k = glyph->kerning[j].kerning;
-        //             //DEBUG_PRINTLN("text[i]: %d text[i+1]: %d k: %f", &text[i], &text[i-1], k);
-        //             break;
-        //         }
-        //     }
-        // }
-
         // Calculate the size and location based on the current character's glyph
         float ox = ix + glyph->offset_x + kerning;
         float oy = iy + glyph->offset_y;
         float w  = (float)glyph->width;
         float h  = (float)glyph->height;
         
-        // Draw the letter
-        glBegin(GL_TRIANGLES);
-        glColor4f(1.0, 1.0, 1.0, 1.0);
-        glTexCoord2f(glyph->s0, glyph->t0); glVertex3f(ox,     oy    , z);
-        glTexCoord2f(glyph->s0, glyph->t1); glVertex3f(ox,     oy - h, z);
-        glTexCoord2f(glyph->s1, glyph->t1); glVertex3f(ox + w, oy - h, z);
-        glTexCoord2f(glyph->s0, glyph->t0); glVertex3f(ox,     oy    , z);
-        glTexCoord2f(glyph->s1, glyph->t1); glVertex3f(ox + w, oy - h, z);
-        glTexCoord2f(glyph->s1, glyph->t0); glVertex3f(ox + w, oy    , z);
-        glEnd();
+        // Add the letter's two triangles
+        const GLfloat quad[VERTICES_PER_GLYPH * VERTEX_SIZE] = {
+            ox,     oy,     z, glyph->s0, glyph->t0,
+            ox,     oy - h, z, glyph->s0, glyph->t1,
+            ox + w, oy - h, z, glyph->s1, glyph->t1,
+            ox,     oy,     z, glyph->s0, glyph->t0,
+            ox + w, oy - h, z, glyph->s1, glyph->t1,
+            ox + w, oy,     z, glyph->s1, glyph->t0,
+        };
+        _vertices.insert(_vertices.end(), quad, quad + VERTICES_PER_GLYPH * VERTEX_SIZE);
         
         // Advance to the next letter's position
         ix += glyph->advance_x;
         iy += glyph->advance_y;
     }
 
-    glDisable(GL_TEXTURE_2D);
-}
\ No newline at end of file
+    _builtText = text;
+    _builtX = x;
+    _builtY = y;
+    _builtZ = z;
+    _builtKerning = kerning;
+    _builtFont = _font;
+    _isVerticesBuilt = true;
+    _geometry.invalidate();
+}
+
+void Text::_drawList() {
+    if (_isVerticesDirty()) {
+        _buildVertices();
+    }
+    if (_vertices.empty()) {
+        return;
+    }
+
+    // Set every time since copies of a Text have their own vertices
+    _geometry.layout.stride = (GLsizei)(VERTEX_SIZE * sizeof(GLfloat));
+    _geometry.layout.texCoordOffset = (int)(3 * sizeof(GLfloat));
+    _geometry.vertices = &_vertices[0];
+    _geometry.vertexCount = (GLsizei)(_vertices.size() / VERTEX_SIZE);
+
+    // Draw the whole string at once
+    if (FontTextureCache::isTinted()) {
+        RenderBackend::current().setColor(color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, 1.0);
+        _geometry.draw();
+        // Restore white so the tint doesn't leak into later draws
+        RenderBackend::current().setColor(1.0, 1.0, 1.0, 1.0);
+    } else {
+        RenderBackend::current().setColor(1.0, 1.0, 1.0, 1.0);
+        _geometry.draw();
+    }
+}
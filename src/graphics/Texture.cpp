@@ -1,4 +1,5 @@
 #include "glex/graphics/Texture.h"
+#include "glex/graphics/TextureCompression.h"
 #include "glex/common/log.h"
 #include "glex/common/path.h"
 
@@ -11,6 +12,7 @@
 
 #include <fstream>
 #include <cstdlib>
+#include <cstring>
 
 Texture::~Texture() {
     if (isLoaded()) {
@@ -18,99 +20,261 @@ Texture::~Texture() {
     }
 }
 
-bool Texture::_loadTextureFromFile(std::string path, int numberOfColorComponents, bool flipVertically) {
+bool Texture::_loadTextureFromFile(std::string path, int numberOfColorComponents, TextureFormat format, bool dither, bool flipVertically) {
     if (numberOfColorComponents < 0 || numberOfColorComponents > 4) {
         DEBUG_PRINTLN("ERROR: numberOfColorComponents must be between 0 and 4");
         return false;
     }
 
+    TextureImage image;
+    if (decodeFile(path, numberOfColorComponents, image, flipVertically)) {
+        glex::generateMipmaps(image, mipmapFilter);
+        convertImage(image, format, dither);
+        return loadImage(image);
+    }
+
+    ERROR_PRINTLN("ERROR: couldn't open texture image file");
+    exit(EXIT_FAILURE);
+    return false;
+}
+
+bool Texture::decodeFile(std::string path, int numberOfColorComponents, TextureImage& image, bool flipVertically) {
+    if (numberOfColorComponents != STBI_rgb && numberOfColorComponents != STBI_rgb_alpha) {
+        ERROR_PRINTLN("ERROR: numberOfColorComponents must be 3 or 4");
+        return false;
+    }
+
     std::string platformPath = glex::targetPlatformPath(path);
     DEBUG_PRINTLN("Loading texture from path: %s  components: %d  flipVert: %d", platformPath.c_str(), numberOfColorComponents, flipVertically);
 
-    // Load the image file as a texture
+    // stbi's own flipping is a global setting, so flip while copying instead to stay thread safe
     int w, h, n;
-    stbi_set_flip_vertically_on_load(flipVertically); // Flipping vertically matches OpenGL coordinate system
-    const unsigned char *data = stbi_load(platformPath.c_str(), &w, &h, &n, numberOfColorComponents);
-    if (data != NULL) {
-        bool success = false;
-        switch(numberOfColorComponents) {
-        case STBI_rgb_alpha:
-            success = loadRGBA(w, h, data);
-            break;
-        case STBI_rgb:
-            success = loadRGB(w, h, data);
-            break;
-        }
-        stbi_image_free((void *)data);
-        return success;
+    unsigned char *data = stbi_load(platformPath.c_str(), &w, &h, &n, numberOfColorComponents);
+    if (data == NULL) {
+        ERROR_PRINTLN("ERROR: couldn't decode texture image file %s: %s", platformPath.c_str(), stbi_failure_reason());
+        return false;
     }
 
-    ERROR_PRINTLN("ERROR: couldn't open texture image file");
-    exit(EXIT_FAILURE);
+    // Flipping vertically matches OpenGL coordinate system
+    const size_t rowSize = (size_t)w * numberOfColorComponents;
+    image.width = w;
+    image.height = h;
+    image.components = numberOfColorComponents;
+    image.pixels.resize(rowSize * h);
+    for (int row = 0; row < h; row++) {
+        int sourceRow = flipVertically ? h - 1 - row : row;
+        memcpy(&image.pixels[row * rowSize], data + sourceRow * rowSize, rowSize);
+    }
+    stbi_image_free(data);
+    return true;
+}
+
+void Texture::convertImage(TextureImage& image, TextureFormat format, bool dither) {
+    if (format == TextureFormat::Default || image.format != TextureFormat::Default) {
+        return;
+    }
+
+    std::vector<unsigned char> packed((size_t)image.width * image.height * sizeof(uint16_t));
+    glex::convertPixels(image.pixels.data(), image.components, image.width, image.height, format, dither, (uint16_t*)packed.data());
+    image.pixels.swap(packed);
+    for (size_t level = 1; level <= image.mipmaps.size(); level++) {
+        GLsizei width = glex::mipmapSize(image.width, level);
+        GLsizei height = glex::mipmapSize(image.height, level);
+        std::vector<unsigned char> packedLevel((size_t)width * height * sizeof(uint16_t));
+        glex::convertPixels(image.mipmaps[level - 1].data(), image.components, width, height, format, dither, (uint16_t*)packedLevel.data());
+        image.mipmaps[level - 1].swap(packedLevel);
+    }
+    image.format = format;
+}
+
+bool Texture::loadImage(const TextureImage& image) {
+    if (image.isTwiddled || image.isVQ) {
+        return _loadTwiddled(image);
+    }
+    if (image.format != TextureFormat::Default) {
+        return _loadPacked(image.width, image.height, image.format, (const uint16_t*)image.pixels.data(), &image.mipmaps);
+    }
+
+    switch (image.components) {
+    case STBI_rgb_alpha:
+        _format = TextureFormat::Default;
+        return _upload(GL_RGBA, GL_RGBA, GL_UNSIGNED_BYTE, 4, image.width, image.height, image.pixels.data(), &image.mipmaps);
+    case STBI_rgb:
+        _format = TextureFormat::Default;
+        return _upload(GL_RGB, GL_RGB, GL_UNSIGNED_BYTE, 3, image.width, image.height, image.pixels.data(), &image.mipmaps);
+    }
+    ERROR_PRINTLN("ERROR: unsupported number of texture components: %d", image.components);
     return false;
 }
 
-bool Texture::loadRGBA(std::string path) {
-    return _loadTextureFromFile(path, STBI_rgb_alpha);
+bool Texture::loadRGBA(std::string path, TextureFormat format, bool dither) {
+    return _loadTextureFromFile(path, STBI_rgb_alpha, format, dither);
 }
 
 bool Texture::loadRGBA(GLsizei textureWidth, GLsizei textureHeight, const unsigned char* rgbaData) {
+    return _loadPixels(textureWidth, textureHeight, STBI_rgb_alpha, rgbaData);
+}
+
+bool Texture::loadRGB(std::string path, TextureFormat format, bool dither) {
+    return _loadTextureFromFile(path, STBI_rgb, format, dither);
+}
+
+bool Texture::loadRGB(GLsizei textureWidth, GLsizei textureHeight, const unsigned char* rgbData) {
+    return _loadPixels(textureWidth, textureHeight, STBI_rgb, rgbData);
+}
+
+bool Texture::loadPacked(GLsizei textureWidth, GLsizei textureHeight, TextureFormat format, const uint16_t* packedData) {
+    return _loadPacked(textureWidth, textureHeight, format, packedData, nullptr);
+}
+
+bool Texture::_loadPixels(GLsizei textureWidth, GLsizei textureHeight, int components, const unsigned char* pixels) {
+    if (mipmapFilter == MipmapFilter::None) {
+        _format = TextureFormat::Default;
+        GLenum pixelFormat = components == STBI_rgb_alpha ? GL_RGBA : GL_RGB;
+        return _upload(pixelFormat, pixelFormat, GL_UNSIGNED_BYTE, components, textureWidth, textureHeight, pixels, nullptr);
+    }
+
+    // The mipmaps are built from a copy, the caller keeps its pixels
+    TextureImage image;
+    image.width = textureWidth;
+    image.height = textureHeight;
+    image.components = components;
+    image.pixels.assign(pixels, pixels + (size_t)textureWidth * textureHeight * components);
+    glex::generateMipmaps(image, mipmapFilter);
+    return loadImage(image);
+}
+
+bool Texture::_loadPacked(GLsizei textureWidth, GLsizei textureHeight, TextureFormat format, const uint16_t* packedData,
+                          const std::vector<std::vector<unsigned char>>* mipmaps) {
+    if (format == TextureFormat::Default) {
+        ERROR_PRINTLN("ERROR: loadPacked() needs a 16 bit texture format");
+        return false;
+    }
+
+    GLenum pixelFormat, pixelType;
+    glex::textureFormatGLTypes(format, pixelFormat, pixelType);
+#ifdef DREAMCAST
+    // GLdc picks the PVR format from the pixel type and stores the pixels as they are
+    GLint internalFormat = format == TextureFormat::RGB565 ? GL_RGB : GL_RGBA;
+#else
+    GLint internalFormat = format == TextureFormat::RGB565 ? GL_RGB5 : (format == TextureFormat::ARGB4444 ? GL_RGBA4 : GL_RGB5_A1);
+#endif
+    _format = format;
+    return _upload(internalFormat, pixelFormat, pixelType, sizeof(uint16_t), textureWidth, textureHeight, packedData, mipmaps);
+}
+
+bool Texture::_upload(GLint internalFormat, GLenum pixelFormat, GLenum pixelType, size_t bytesPerPixel,
+                      GLsizei textureWidth, GLsizei textureHeight, const void* pixels,
+                      const std::vector<std::vector<unsigned char>>* mipmaps) {
     if (isLoaded()) {
         unload();
     }
 
+    bool hasMipmaps = mipmaps != nullptr && !mipmaps->empty();
+#ifdef DREAMCAST
+    if (hasMipmaps && textureWidth != textureHeight) {
+        ERROR_PRINTLN("The PVR can only mipmap square textures, skipping mipmaps for a %dx%d texture", (int)textureWidth, (int)textureHeight);
+        hasMipmaps = false;
+    }
+#endif
+
     glGenTextures(1, &id);
-    glBindTexture(GL_TEXTURE_2D, id);
+    GLStateCache::bindTexture(id);
 
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, textureWidth, textureHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, rgbaData);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, hasMipmaps ? GL_LINEAR_MIPMAP_NEAREST : GL_LINEAR);
+    // Rows are tightly packed, desktop GL would otherwise expect each one padded to 4 bytes (an
+    // RGB 2x2 mip level or a 16 bit 1 pixel wide one). GLdc ignores this and always reads packed rows.
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, textureWidth, textureHeight, 0, pixelFormat, pixelType, pixels);
+    size_t byteSize = (size_t)textureWidth * textureHeight * bytesPerPixel;
+    if (hasMipmaps) {
+        for (size_t level = 1; level <= mipmaps->size(); level++) {
+            GLsizei levelWidth = glex::mipmapSize(textureWidth, level);
+            GLsizei levelHeight = glex::mipmapSize(textureHeight, level);
+            glTexImage2D(GL_TEXTURE_2D, (GLint)level, internalFormat, levelWidth, levelHeight, 0, pixelFormat, pixelType, (*mipmaps)[level - 1].data());
+            byteSize += (size_t)levelWidth * levelHeight * bytesPerPixel;
+        }
+    }
 
     GLenum error = glGetError();
     if (error != GL_NO_ERROR) {
-        ERROR_PRINT("Failed to load RGBA texture with GL error: %d", error);
+        ERROR_PRINT("Failed to load texture with GL error: %d", error);
         return false;
     }
 
     _width = textureWidth;
     _height = textureHeight;
+    _byteSize = byteSize;
     return true;
 }
 
-bool Texture::loadRGB(std::string path) {
-    return _loadTextureFromFile(path, STBI_rgb);
+bool Texture::loadCompressed(std::string path) {
+    TextureImage image;
+    if (!glex::readTextureFile(path, image)) {
+        return false;
+    }
+    return loadImage(image);
 }
 
-bool Texture::loadRGB(GLsizei textureWidth, GLsizei textureHeight, const unsigned char* rgbData) {
+bool Texture::_loadTwiddled(const TextureImage& image) {
+#ifdef DREAMCAST
     if (isLoaded()) {
         unload();
     }
 
     glGenTextures(1, &id);
-    glBindTexture(GL_TEXTURE_2D, id);
+    GLStateCache::bindTexture(id);
 
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, textureWidth, textureHeight, 0, GL_RGB, GL_UNSIGNED_BYTE, rgbData);
+
+    // Both are copied to VRAM as they are, GLdc only needs to know the layout
+    if (image.isVQ) {
+        GLenum internalFormat = GL_COMPRESSED_RGB_565_VQ_TWID_KOS;
+        if (image.format == TextureFormat::ARGB4444) internalFormat = GL_COMPRESSED_ARGB_4444_VQ_TWID_KOS;
+        if (image.format == TextureFormat::ARGB1555) internalFormat = GL_COMPRESSED_ARGB_1555_VQ_TWID_KOS;
+        glCompressedTexImage2DARB(GL_TEXTURE_2D, 0, internalFormat, image.width, image.height, 0, (GLsizei)image.pixels.size(), image.pixels.data());
+    } else {
+        GLenum pixelFormat = image.format == TextureFormat::RGB565 ? GL_RGB : GL_BGRA;
+        GLenum pixelType = GL_UNSIGNED_SHORT_5_6_5_TWID_KOS;
+        if (image.format == TextureFormat::ARGB4444) pixelType = GL_UNSIGNED_SHORT_4_4_4_4_REV_TWID_KOS;
+        if (image.format == TextureFormat::ARGB1555) pixelType = GL_UNSIGNED_SHORT_1_5_5_5_REV_TWID_KOS;
+        glTexImage2D(GL_TEXTURE_2D, 0, image.format == TextureFormat::RGB565 ? GL_RGB : GL_RGBA, image.width, image.height, 0, pixelFormat, pixelType, image.pixels.data());
+    }
 
     GLenum error = glGetError();
     if (error != GL_NO_ERROR) {
-        ERROR_PRINT("Failed to load RGBA texture with GL error: %d", error);
+        ERROR_PRINT("Failed to load twiddled texture with GL error: %d", error);
         return false;
     }
 
-    _width = textureWidth;
-    _height = textureHeight;
+    _width = image.width;
+    _height = image.height;
+    _byteSize = image.pixels.size();
+    _format = image.format;
     return true;
+#else
+    // Desktop GL can't sample either layout, so expand to linear pixels
+    std::vector<uint16_t> linear((size_t)image.width * image.height);
+    if (image.isVQ) {
+        glex::decodeVQ(image.pixels.data(), image.width, image.height, linear.data());
+    } else {
+        glex::untwiddle((const uint16_t*)image.pixels.data(), image.width, image.height, linear.data());
+    }
+    return loadPacked(image.width, image.height, image.format, linear.data());
+#endif
 }
 
 bool Texture::loadExisting(GLsizei textureWidth, GLsizei textureHeight, GLuint textureId) {
     _width = textureWidth;
     _height = textureHeight;
+    _byteSize = 0;
+    _format = TextureFormat::Default;
     id = textureId;
 
     // TODO: Use glAreTexturesResident to check if the texture actually exists, for now always return true
@@ -119,8 +283,9 @@ bool Texture::loadExisting(GLsizei textureWidth, GLsizei textureHeight, GLuint t
 
 void Texture::unload() {
     if (isLoaded()) {
-        glDeleteTextures(1, &id);
+        GLStateCache::deleteTextures(1, &id);
         id = 0;
+        _byteSize = 0;
     }
 }
 
@@ -0,0 +1,234 @@
+#include "glex/graphics/TextureAtlas.h"
+#include "glex/common/log.h"
+
+#include <algorithm>
+#include <cstring>
+
+static GLsizei _nextPowerOfTwo(GLsizei size) {
+    GLsizei powerOfTwo = 1;
+    while (powerOfTwo < size) {
+        powerOfTwo <<= 1;
+    }
+    return powerOfTwo;
+}
+
+TextureAtlas::TextureAtlas(GLsizei maxPageSize, GLsizei padding, TextureFormat format, bool dither) {
+    _maxPageSize = _nextPowerOfTwo(maxPageSize);
+    _padding = padding;
+    _format = format;
+    _dither = dither;
+}
+
+int TextureAtlas::add(std::string path) {
+    TextureImage image;
+    if (!Texture::decodeFile(path, 4, image)) {
+        return -1;
+    }
+    return add(image);
+}
+
+int TextureAtlas::add(const TextureImage& image) {
+    if (_isBuilt) {
+        ERROR_PRINTLN("ERROR: can't add images to a texture atlas after building it");
+        return -1;
+    }
+    if (image.format != TextureFormat::Default || (image.components != 3 && image.components != 4)) {
+        ERROR_PRINTLN("ERROR: texture atlases need decoded 8 bit RGB or RGBA images");
+        return -1;
+    }
+    _Entry entry;
+    entry.image = image;
+    entry.image.mipmaps.clear();
+    _entries.push_back(std::move(entry));
+    return (int)_entries.size() - 1;
+}
+
+// Finds the lowest (then leftmost) spot for a width x height rectangle on the skyline and raises
+// the skyline over it
+bool TextureAtlas::_insert(std::vector<_SkylineSegment>& skyline, GLsizei pageSize, GLsizei width, GLsizei height, GLsizei& x, GLsizei& y) {
+    size_t bestIndex = skyline.size();
+    GLsizei bestY = pageSize;
+    for (size_t i = 0; i < skyline.size(); i++) {
+        GLsizei left = skyline[i].x;
+        if (left + width > pageSize) {
+            break;
+        }
+        // The rectangle rests on the highest segment under it
+        GLsizei top = 0;
+        for (size_t j = i; j < skyline.size() && skyline[j].x < left + width; j++) {
+            top = std::max(top, skyline[j].y);
+        }
+        if (top + height <= pageSize && top < bestY) {
+            bestIndex = i;
+            bestY = top;
+        }
+    }
+    if (bestIndex == skyline.size()) {
+        return false;
+    }
+
+    x = skyline[bestIndex].x;
+    y = bestY;
+    _SkylineSegment segment = { x, y + height, width };
+    skyline.insert(skyline.begin() + bestIndex, segment);
+
+    // Cut the segments now covered by the new one
+    size_t i = bestIndex + 1;
+    while (i < skyline.size() && skyline[i].x < x + width) {
+        GLsizei overlap = x + width - skyline[i].x;
+        if (overlap >= skyline[i].width) {
+            skyline.erase(skyline.begin() + i);
+        } else {
+            skyline[i].x += overlap;
+            skyline[i].width -= overlap;
+            break;
+        }
+    }
+    // Merge neighbors at the same height
+    for (i = 0; i + 1 < skyline.size();) {
+        if (skyline[i].y == skyline[i + 1].y) {
+            skyline[i].width += skyline[i + 1].width;
+            skyline.erase(skyline.begin() + i + 1);
+        } else {
+            i++;
+        }
+    }
+    return true;
+}
+
+bool TextureAtlas::build() {
+    if (_isBuilt) {
+        return true;
+    }
+
+    bool success = _pack([this](TextureImage& pageImage) {
+        Texture::convertImage(pageImage, _format, _dither);
+        std::shared_ptr<Texture> texture = std::make_shared<Texture>();
+        if (!texture->loadImage(pageImage)) {
+            return false;
+        }
+        _pages.push_back(texture);
+        return true;
+    });
+    if (!success) {
+        return false;
+    }
+
+    // The pixels are on the GPU now
+    for (_Entry& entry : _entries) {
+        entry.region.texture = _pages[entry.page].get();
+        std::vector<unsigned char>().swap(entry.image.pixels);
+    }
+    _isBuilt = true;
+
+    DEBUG_PRINTLN("TextureAtlas - Packed %u images into %u pages", (unsigned)_entries.size(), (unsigned)_pages.size());
+    return true;
+}
+
+bool TextureAtlas::buildImages(std::vector<TextureImage>& pageImages) {
+    if (_isBuilt) {
+        ERROR_PRINTLN("ERROR: the texture atlas was already built, its pixels are gone");
+        return false;
+    }
+    pageImages.clear();
+    return _pack([&pageImages](TextureImage& pageImage) {
+        pageImages.push_back(std::move(pageImage));
+        return true;
+    });
+}
+
+bool TextureAtlas::_pack(const _PageCallback& onPage) {
+    // Tallest first packs much tighter on a skyline
+    std::vector<size_t> order(_entries.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return _entries[a].image.height > _entries[b].image.height;
+    });
+    for (_Entry& entry : _entries) {
+        entry.page = NO_PAGE;
+    }
+
+    std::vector<_SkylineSegment> skyline;
+    size_t page = 0;
+    GLsizei usedWidth = 0;
+    GLsizei usedHeight = 0;
+    skyline.push_back({ 0, 0, _maxPageSize });
+    for (size_t index : order) {
+        _Entry& entry = _entries[index];
+        GLsizei width = entry.image.width + _padding * 2;
+        GLsizei height = entry.image.height + _padding * 2;
+        if (width > _maxPageSize || height > _maxPageSize) {
+            ERROR_PRINTLN("ERROR: a %dx%d image doesn't fit in a %d texture atlas page", (int)entry.image.width, (int)entry.image.height, (int)_maxPageSize);
+            return false;
+        }
+
+        GLsizei x, y;
+        if (!_insert(skyline, _maxPageSize, width, height, x, y)) {
+            // Full, start the next page
+            TextureImage pageImage;
+            _composePage(page, usedWidth, usedHeight, pageImage);
+            if (!onPage(pageImage)) {
+                return false;
+            }
+            page++;
+            usedWidth = 0;
+            usedHeight = 0;
+            skyline.clear();
+            skyline.push_back({ 0, 0, _maxPageSize });
+            _insert(skyline, _maxPageSize, width, height, x, y);
+        }
+        entry.page = page;
+        entry.x = x + _padding;
+        entry.y = y + _padding;
+        usedWidth = std::max(usedWidth, x + width);
+        usedHeight = std::max(usedHeight, y + height);
+    }
+    if (!_entries.empty()) {
+        TextureImage pageImage;
+        _composePage(page, usedWidth, usedHeight, pageImage);
+        if (!onPage(pageImage)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void TextureAtlas::_composePage(size_t page, GLsizei usedWidth, GLsizei usedHeight, TextureImage& pageImage) {
+    pageImage.width = _nextPowerOfTwo(usedWidth);
+    pageImage.height = _nextPowerOfTwo(usedHeight);
+    pageImage.components = 4;
+    pageImage.pixels.assign((size_t)pageImage.width * pageImage.height * 4, 0);
+
+    for (_Entry& entry : _entries) {
+        if (entry.page != page) {
+            continue;
+        }
+
+        // Copy the image and extend its edges into the padding, clamping like GL_CLAMP_TO_EDGE
+        const TextureImage& image = entry.image;
+        for (GLsizei row = -_padding; row < image.height + _padding; row++) {
+            GLsizei sourceRow = std::min(std::max(row, 0), image.height - 1);
+            const unsigned char* source = &image.pixels[(size_t)sourceRow * image.width * image.components];
+            unsigned char* destination = &pageImage.pixels[((size_t)(entry.y + row) * pageImage.width + entry.x) * 4];
+            for (GLsizei column = -_padding; column < image.width + _padding; column++) {
+                GLsizei sourceColumn = std::min(std::max(column, 0), image.width - 1);
+                const unsigned char* pixel = source + sourceColumn * image.components;
+                unsigned char* output = destination + column * 4;
+                output[0] = pixel[0];
+                output[1] = pixel[1];
+                output[2] = pixel[2];
+                output[3] = image.components == 4 ? pixel[3] : 255;
+            }
+        }
+
+        entry.region.page = page;
+        entry.region.width = image.width;
+        entry.region.height = image.height;
+        entry.region.uv.s0 = (GLfloat)entry.x / pageImage.width;
+        entry.region.uv.t0 = (GLfloat)entry.y / pageImage.height;
+        entry.region.uv.s1 = (GLfloat)(entry.x + image.width) / pageImage.width;
+        entry.region.uv.t1 = (GLfloat)(entry.y + image.height) / pageImage.height;
+    }
+}
@@ -0,0 +1,299 @@
+#include "glex/graphics/TextureCompression.h"
+#include "glex/common/texturefile.h"
+#include "glex/common/log.h"
+#include "glex/common/path.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+static bool _isPowerOfTwo(GLsizei size) {
+    return size > 0 && (size & (size - 1)) == 0;
+}
+
+bool glex::isTwiddleSizeValid(GLsizei width, GLsizei height) {
+    return _isPowerOfTwo(width) && _isPowerOfTwo(height) && width >= 8 && height >= 8 && width <= 1024 && height <= 1024;
+}
+
+void glex::twiddle(const uint16_t* pixels, GLsizei width, GLsizei height, uint16_t* output) {
+    for (GLsizei y = 0; y < height; y++) {
+        for (GLsizei x = 0; x < width; x++) {
+            output[twiddledIndex(x, y, width, height)] = pixels[(size_t)y * width + x];
+        }
+    }
+}
+
+void glex::untwiddle(const uint16_t* twiddled, GLsizei width, GLsizei height, uint16_t* output) {
+    for (GLsizei y = 0; y < height; y++) {
+        for (GLsizei x = 0; x < width; x++) {
+            output[(size_t)y * width + x] = twiddled[twiddledIndex(x, y, width, height)];
+        }
+    }
+}
+
+// A 2x2 block of RGBA texels in twiddled order: (0, 0), (0, 1), (1, 0), (1, 1)
+struct _VQBlock {
+    float values[16];
+};
+
+static float _distance(const _VQBlock& a, const _VQBlock& b) {
+    float distance = 0;
+    for (int i = 0; i < 16; i++) {
+        float difference = a.values[i] - b.values[i];
+        distance += difference * difference;
+    }
+    return distance;
+}
+
+bool glex::encodeVQ(const TextureImage& image, TextureFormat format, std::vector<unsigned char>& output, int iterations) {
+    if (format == TextureFormat::Default || image.format != TextureFormat::Default || image.width != image.height ||
+        !isTwiddleSizeValid(image.width, image.height)) {
+        ERROR_PRINTLN("ERROR: VQ needs a decoded square image with power of two sides from 8 to 1024");
+        return false;
+    }
+
+    const GLsizei blocksWide = image.width / 2;
+    const GLsizei blocksHigh = image.height / 2;
+    const size_t numBlocks = (size_t)blocksWide * blocksHigh;
+    std::vector<_VQBlock> blocks(numBlocks);
+    for (GLsizei by = 0; by < blocksHigh; by++) {
+        for (GLsizei bx = 0; bx < blocksWide; bx++) {
+            _VQBlock& block = blocks[(size_t)by * blocksWide + bx];
+            for (int texel = 0; texel < 4; texel++) {
+                GLsizei x = bx * 2 + (texel >> 1);
+                GLsizei y = by * 2 + (texel & 1);
+                const unsigned char* pixel = &image.pixels[((size_t)y * image.width + x) * image.components];
+                for (int channel = 0; channel < 4; channel++) {
+                    block.values[texel * 4 + channel] = channel < image.components ? pixel[channel] : 255.0f;
+                }
+            }
+        }
+    }
+
+    // Start from blocks spread evenly over the image, then refine with k-means
+    std::vector<_VQBlock> codes(VQ_CODEBOOK_ENTRIES);
+    for (size_t i = 0; i < VQ_CODEBOOK_ENTRIES; i++) {
+        codes[i] = blocks[i * numBlocks / VQ_CODEBOOK_ENTRIES];
+    }
+
+    std::vector<uint8_t> assignments(numBlocks);
+    std::vector<float> distances(numBlocks);
+    std::vector<_VQBlock> sums(VQ_CODEBOOK_ENTRIES);
+    std::vector<size_t> counts(VQ_CODEBOOK_ENTRIES);
+    for (int iteration = 0; iteration <= iterations; iteration++) {
+        for (size_t i = 0; i < numBlocks; i++) {
+            float best = _distance(blocks[i], codes[0]);
+            size_t bestCode = 0;
+            for (size_t code = 1; code < VQ_CODEBOOK_ENTRIES && best > 0; code++) {
+                float distance = _distance(blocks[i], codes[code]);
+                if (distance < best) {
+                    best = distance;
+                    bestCode = code;
+                }
+            }
+            assignments[i] = (uint8_t)bestCode;
+            distances[i] = best;
+        }
+        if (iteration == iterations) {
+            break;
+        }
+
+        std::fill(sums.begin(), sums.end(), _VQBlock());
+        std::fill(counts.begin(), counts.end(), 0);
+        for (size_t i = 0; i < numBlocks; i++) {
+            _VQBlock& sum = sums[assignments[i]];
+            for (int v = 0; v < 16; v++) {
+                sum.values[v] += blocks[i].values[v];
+            }
+            counts[assignments[i]]++;
+        }
+        for (size_t code = 0; code < VQ_CODEBOOK_ENTRIES; code++) {
+            if (counts[code] > 0) {
+                for (int v = 0; v < 16; v++) {
+                    codes[code].values[v] = sums[code].values[v] / counts[code];
+                }
+            } else {
+                // Move unused codes to the block that's currently worst off
+                size_t worst = std::max_element(distances.begin(), distances.end()) - distances.begin();
+                codes[code] = blocks[worst];
+                distances[worst] = 0;
+            }
+        }
+    }
+
+    output.resize(vqDataSize(image.width, image.height));
+    uint16_t* codebook = (uint16_t*)output.data();
+    for (size_t code = 0; code < VQ_CODEBOOK_ENTRIES; code++) {
+        unsigned char texels[16];
+        for (int v = 0; v < 16; v++) {
+            float value = codes[code].values[v] + 0.5f;
+            texels[v] = value >= 255.0f ? 255 : (unsigned char)value;
+        }
+        convertPixels(texels, 4, 4, 1, format, false, codebook + code * 4);
+    }
+    unsigned char* indices = output.data() + VQ_CODEBOOK_SIZE;
+    for (GLsizei by = 0; by < blocksHigh; by++) {
+        for (GLsizei bx = 0; bx < blocksWide; bx++) {
+            indices[twiddledIndex(bx, by, blocksWide, blocksHigh)] = assignments[(size_t)by * blocksWide + bx];
+        }
+    }
+    return true;
+}
+
+void glex::decodeVQ(const unsigned char* data, GLsizei width, GLsizei height, uint16_t* output) {
+    const uint16_t* codebook = (const uint16_t*)data;
+    const unsigned char* indices = data + VQ_CODEBOOK_SIZE;
+    const GLsizei blocksWide = width / 2;
+    const GLsizei blocksHigh = height / 2;
+    for (GLsizei by = 0; by < blocksHigh; by++) {
+        for (GLsizei bx = 0; bx < blocksWide; bx++) {
+            const uint16_t* code = codebook + indices[twiddledIndex(bx, by, blocksWide, blocksHigh)] * 4;
+            for (int texel = 0; texel < 4; texel++) {
+                GLsizei x = bx * 2 + (texel >> 1);
+                GLsizei y = by * 2 + (texel & 1);
+                output[(size_t)y * width + x] = code[texel];
+            }
+        }
+    }
+}
+
+bool glex::compressImage(TextureImage& image, TextureFormat format, bool vq, bool dither) {
+    if (image.format != TextureFormat::Default || format == TextureFormat::Default) {
+        ERROR_PRINTLN("ERROR: compressImage() needs a decoded image and a 16 bit format");
+        return false;
+    }
+    if (!image.mipmaps.empty()) {
+        ERROR_PRINTLN("ERROR: twiddled textures with mipmaps aren't supported yet");
+        return false;
+    }
+    if (!isTwiddleSizeValid(image.width, image.height)) {
+        ERROR_PRINTLN("ERROR: can't twiddle a %dx%d texture, sides must be powers of two from 8 to 1024", (int)image.width, (int)image.height);
+        return false;
+    }
+
+    if (vq) {
+        std::vector<unsigned char> data;
+        if (!encodeVQ(image, format, data)) {
+            return false;
+        }
+        image.pixels.swap(data);
+        image.format = format;
+        image.isVQ = true;
+    } else {
+        Texture::convertImage(image, format, dither);
+        std::vector<unsigned char> twiddled(image.pixels.size());
+        twiddle((const uint16_t*)image.pixels.data(), image.width, image.height, (uint16_t*)twiddled.data());
+        image.pixels.swap(twiddled);
+    }
+    image.isTwiddled = true;
+    return true;
+}
+
+// The PVR's largest texture side, also the limit for linear textures so sizes can't overflow
+static constexpr uint32_t MAX_TEXTURE_FILE_SIZE = 1024;
+
+static size_t _textureFileDataSize(const TextureFileHeader& header) {
+    if (header.flags & TEXTURE_FILE_VQ) {
+        return glex::vqDataSize(header.width, header.height);
+    }
+    return (size_t)header.width * header.height * sizeof(uint16_t);
+}
+
+bool glex::readTextureFile(std::string path, TextureImage& image) {
+    std::string platformPath = targetPlatformPath(path);
+    DEBUG_PRINTLN("Loading texture file %s", platformPath.c_str());
+
+    FILE* file = fopen(platformPath.c_str(), "rb");
+    if (file == NULL) {
+        ERROR_PRINTLN("Couldn't open texture file %s", platformPath.c_str());
+        return false;
+    }
+
+    long fileLength = -1;
+    if (fseek(file, 0, SEEK_END) == 0) {
+        fileLength = ftell(file);
+    }
+
+    TextureFileHeader header;
+    if (fileLength < (long)sizeof(header) || fseek(file, 0, SEEK_SET) != 0 ||
+        fread(&header, 1, sizeof(header), file) != sizeof(header) || memcmp(header.magic, TEXTURE_FILE_MAGIC, sizeof(header.magic)) != 0) {
+        ERROR_PRINTLN("Not a glextex file: %s", platformPath.c_str());
+        fclose(file);
+        return false;
+    }
+    if (header.version != TEXTURE_FILE_VERSION) {
+        ERROR_PRINTLN("Unsupported glextex version %d (expected %d): %s", (int)header.version, (int)TEXTURE_FILE_VERSION, platformPath.c_str());
+        fclose(file);
+        return false;
+    }
+    TextureFormat format = (TextureFormat)header.format;
+    bool isTwiddled = (header.flags & (TEXTURE_FILE_TWIDDLED | TEXTURE_FILE_VQ)) != 0;
+    // Bound the size before _textureFileDataSize() multiplies it out, and check the pixels are
+    // really in the file before allocating them
+    if ((format != TextureFormat::RGB565 && format != TextureFormat::ARGB4444 && format != TextureFormat::ARGB1555) ||
+        header.width == 0 || header.height == 0 || header.width > MAX_TEXTURE_FILE_SIZE || header.height > MAX_TEXTURE_FILE_SIZE ||
+        (isTwiddled && !isTwiddleSizeValid(header.width, header.height)) || header.dataSize != _textureFileDataSize(header) ||
+        header.dataOffset < sizeof(header) || (uint64_t)header.dataOffset + header.dataSize > (uint64_t)fileLength) {
+        ERROR_PRINTLN("Corrupt glextex header: %s", platformPath.c_str());
+        fclose(file);
+        return false;
+    }
+
+    image.width = header.width;
+    image.height = header.height;
+    image.components = format == TextureFormat::RGB565 ? 3 : 4;
+    image.format = format;
+    image.isTwiddled = isTwiddled;
+    image.isVQ = (header.flags & TEXTURE_FILE_VQ) != 0;
+    image.pixels.resize(header.dataSize);
+    bool success = fseek(file, header.dataOffset, SEEK_SET) == 0 && fread(image.pixels.data(), 1, header.dataSize, file) == header.dataSize;
+    fclose(file);
+    if (!success) {
+        ERROR_PRINTLN("Truncated glextex file: %s", platformPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool glex::writeTextureFile(const TextureImage& image, std::string path) {
+    if (image.format == TextureFormat::Default) {
+        ERROR_PRINTLN("ERROR: glextex files store 16 bit formats only");
+        return false;
+    }
+    if (image.width <= 0 || image.height <= 0 || image.width > (GLsizei)MAX_TEXTURE_FILE_SIZE || image.height > (GLsizei)MAX_TEXTURE_FILE_SIZE) {
+        ERROR_PRINTLN("ERROR: glextex textures are at most %dx%d", (int)MAX_TEXTURE_FILE_SIZE, (int)MAX_TEXTURE_FILE_SIZE);
+        return false;
+    }
+
+    TextureFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, TEXTURE_FILE_MAGIC, sizeof(header.magic));
+    header.version = TEXTURE_FILE_VERSION;
+    header.flags = (image.isTwiddled ? TEXTURE_FILE_TWIDDLED : 0) | (image.isVQ ? TEXTURE_FILE_VQ : 0);
+    header.format = (uint32_t)image.format;
+    header.width = image.width;
+    header.height = image.height;
+    header.dataOffset = (sizeof(header) + TEXTURE_FILE_ALIGNMENT - 1) / TEXTURE_FILE_ALIGNMENT * TEXTURE_FILE_ALIGNMENT;
+    header.dataSize = (uint32_t)image.pixels.size();
+    if (header.dataSize != _textureFileDataSize(header)) {
+        ERROR_PRINTLN("ERROR: texture data doesn't match its size and format");
+        return false;
+    }
+
+    FILE* file = fopen(path.c_str(), "wb");
+    if (file == NULL) {
+        ERROR_PRINTLN("Couldn't create texture file %s", path.c_str());
+        return false;
+    }
+    std::vector<unsigned char> padding(header.dataOffset - sizeof(header), 0);
+    bool success =
+        fwrite(&header, 1, sizeof(header), file) == sizeof(header) &&
+        (padding.empty() || fwrite(padding.data(), 1, padding.size(), file) == padding.size()) &&
+        fwrite(image.pixels.data(), 1, image.pixels.size(), file) == image.pixels.size();
+    success = fclose(file) == 0 && success;
+    if (!success) {
+        ERROR_PRINTLN("Failed writing texture file %s", path.c_str());
+    }
+    return success;
+}
@@ -0,0 +1,190 @@
+#include "glex/graphics/TextureFormat.h"
+
+#include <vector>
+
+#if defined(__SSE2__) && !defined(DREAMCAST)
+#include <emmintrin.h>
+#endif
+
+// All the kernels work on RGBA pixels read as little endian 32 bit words (R in the low byte), and
+// pack them with the same shifts and masks per channel:
+//
+//   RGB565:   R << 8 & 0xF800  |  G >> 5 & 0x07E0  |  B >> 19 & 0x001F
+//   ARGB4444: A >> 16 & 0xF000  |  R << 4 & 0x0F00  |  G >> 8 & 0x00F0  |  B >> 20 & 0x000F
+//   ARGB1555: A >> 16 & 0x8000  |  R << 7 & 0x7C00  |  G >> 6 & 0x03E0  |  B >> 19 & 0x001F
+
+static const uint8_t _bayer4x4[4][4] = {
+    {  0,  8,  2, 10 },
+    { 12,  4, 14,  6 },
+    {  3, 11,  1,  9 },
+    { 15,  7, 13,  5 }
+};
+
+// Bits dropped from the red, green and blue channels
+static void _droppedBits(TextureFormat format, int& r, int& g, int& b) {
+    switch (format) {
+    case TextureFormat::RGB565:   r = 3; g = 2; b = 3; break;
+    case TextureFormat::ARGB4444: r = 4; g = 4; b = 4; break;
+    default:                      r = 3; g = 3; b = 3; break;
+    }
+}
+
+// The dither added to the pixels of a row before packing, one word per x % 4. Each threshold is
+// scaled to just under one step of its channel, and alpha is never dithered.
+static void _ditherRow(TextureFormat format, GLsizei y, uint32_t bias[4]) {
+    int rBits, gBits, bBits;
+    _droppedBits(format, rBits, gBits, bBits);
+    for (int x = 0; x < 4; x++) {
+        uint32_t threshold = _bayer4x4[y & 3][x];
+        bias[x] = ((threshold << rBits) >> 4) | (((threshold << gBits) >> 4) << 8) | (((threshold << bBits) >> 4) << 16);
+    }
+}
+
+static inline uint32_t _addSaturated(uint32_t pixel, uint32_t bias) {
+    uint32_t r = (pixel & 0xFF) + (bias & 0xFF);
+    uint32_t g = ((pixel >> 8) & 0xFF) + ((bias >> 8) & 0xFF);
+    uint32_t b = ((pixel >> 16) & 0xFF) + ((bias >> 16) & 0xFF);
+    if (r > 0xFF) r = 0xFF;
+    if (g > 0xFF) g = 0xFF;
+    if (b > 0xFF) b = 0xFF;
+    return (pixel & 0xFF000000) | (b << 16) | (g << 8) | r;
+}
+
+template <TextureFormat Format>
+static inline uint32_t _pack(uint32_t p) {
+    switch (Format) {
+    case TextureFormat::RGB565:
+        return ((p << 8) & 0xF800) | ((p >> 5) & 0x07E0) | ((p >> 19) & 0x001F);
+    case TextureFormat::ARGB4444:
+        return ((p >> 16) & 0xF000) | ((p << 4) & 0x0F00) | ((p >> 8) & 0x00F0) | ((p >> 20) & 0x000F);
+    default:
+        return ((p >> 16) & 0x8000) | ((p << 7) & 0x7C00) | ((p >> 6) & 0x03E0) | ((p >> 19) & 0x001F);
+    }
+}
+
+#if defined(__SSE2__) && !defined(DREAMCAST)
+template <TextureFormat Format>
+static inline __m128i _pack4(__m128i p) {
+    switch (Format) {
+    case TextureFormat::RGB565:
+        return _mm_or_si128(_mm_or_si128(
+            _mm_and_si128(_mm_slli_epi32(p, 8), _mm_set1_epi32(0xF800)),
+            _mm_and_si128(_mm_srli_epi32(p, 5), _mm_set1_epi32(0x07E0))),
+            _mm_and_si128(_mm_srli_epi32(p, 19), _mm_set1_epi32(0x001F)));
+    case TextureFormat::ARGB4444:
+        return _mm_or_si128(_mm_or_si128(
+            _mm_and_si128(_mm_srli_epi32(p, 16), _mm_set1_epi32(0xF000)),
+            _mm_and_si128(_mm_slli_epi32(p, 4), _mm_set1_epi32(0x0F00))), _mm_or_si128(
+            _mm_and_si128(_mm_srli_epi32(p, 8), _mm_set1_epi32(0x00F0)),
+            _mm_and_si128(_mm_srli_epi32(p, 20), _mm_set1_epi32(0x000F))));
+    default:
+        return _mm_or_si128(_mm_or_si128(
+            _mm_and_si128(_mm_srli_epi32(p, 16), _mm_set1_epi32(0x8000)),
+            _mm_and_si128(_mm_slli_epi32(p, 7), _mm_set1_epi32(0x7C00))), _mm_or_si128(
+            _mm_and_si128(_mm_srli_epi32(p, 6), _mm_set1_epi32(0x03E0)),
+            _mm_and_si128(_mm_srli_epi32(p, 19), _mm_set1_epi32(0x001F))));
+    }
+}
+
+// SSE2 has no unsigned 32 to 16 bit pack, so sign extend the low halves and use the signed one
+static inline __m128i _packTo16(__m128i low, __m128i high) {
+    low = _mm_srai_epi32(_mm_slli_epi32(low, 16), 16);
+    high = _mm_srai_epi32(_mm_slli_epi32(high, 16), 16);
+    return _mm_packs_epi32(low, high);
+}
+#endif
+
+template <TextureFormat Format>
+static void _packRow(const uint32_t* source, uint16_t* output, GLsizei width, const uint32_t* bias) {
+    GLsizei x = 0;
+#if defined(__SSE2__) && !defined(DREAMCAST)
+    // 8 pixels at a time, the dither pattern repeats every 4 so it lines up with each load
+    __m128i biasVector = bias != nullptr ? _mm_loadu_si128((const __m128i*)bias) : _mm_setzero_si128();
+    for (; x + 8 <= width; x += 8) {
+        __m128i low = _mm_adds_epu8(_mm_loadu_si128((const __m128i*)(source + x)), biasVector);
+        __m128i high = _mm_adds_epu8(_mm_loadu_si128((const __m128i*)(source + x + 4)), biasVector);
+        _mm_storeu_si128((__m128i*)(output + x), _packTo16(_pack4<Format>(low), _pack4<Format>(high)));
+    }
+#else
+    // Two pixels per 32 bit store. Rows of even width keep the output word aligned.
+    if (((uintptr_t)output & 3) == 0) {
+        uint32_t* output32 = (uint32_t*)output;
+        if (bias != nullptr) {
+            for (; x + 4 <= width; x += 4) {
+                output32[(x >> 1)]     = _pack<Format>(_addSaturated(source[x], bias[0])) | (_pack<Format>(_addSaturated(source[x + 1], bias[1])) << 16);
+                output32[(x >> 1) + 1] = _pack<Format>(_addSaturated(source[x + 2], bias[2])) | (_pack<Format>(_addSaturated(source[x + 3], bias[3])) << 16);
+            }
+        } else {
+            for (; x + 4 <= width; x += 4) {
+                output32[(x >> 1)]     = _pack<Format>(source[x]) | (_pack<Format>(source[x + 1]) << 16);
+                output32[(x >> 1) + 1] = _pack<Format>(source[x + 2]) | (_pack<Format>(source[x + 3]) << 16);
+            }
+        }
+    }
+#endif
+    for (; x < width; x++) {
+        uint32_t pixel = bias != nullptr ? _addSaturated(source[x], bias[x & 3]) : source[x];
+        output[x] = (uint16_t)_pack<Format>(pixel);
+    }
+}
+
+template <TextureFormat Format>
+static void _convert(const unsigned char* pixels, int components, GLsizei width, GLsizei height, bool dither, uint16_t* output) {
+    std::vector<uint32_t> expandedRow(components == 3 ? width : 0);
+    uint32_t bias[4];
+    for (GLsizei y = 0; y < height; y++) {
+        const uint32_t* row;
+        if (components == 4) {
+            row = (const uint32_t*)(pixels + (size_t)y * width * 4);
+        } else {
+            // Expand RGB rows to opaque RGBA so every format shares the same kernels
+            const unsigned char* source = pixels + (size_t)y * width * 3;
+            for (GLsizei x = 0; x < width; x++) {
+                expandedRow[x] = 0xFF000000 | ((uint32_t)source[x * 3 + 2] << 16) | ((uint32_t)source[x * 3 + 1] << 8) | source[x * 3];
+            }
+            row = expandedRow.data();
+        }
+        if (dither) {
+            _ditherRow(Format, y, bias);
+        }
+        _packRow<Format>(row, output + (size_t)y * width, width, dither ? bias : nullptr);
+    }
+}
+
+void glex::textureFormatGLTypes(TextureFormat format, GLenum& pixelFormat, GLenum& pixelType) {
+    switch (format) {
+    case TextureFormat::RGB565:
+        pixelFormat = GL_RGB;
+        pixelType = GL_UNSIGNED_SHORT_5_6_5;
+        break;
+    case TextureFormat::ARGB4444:
+        pixelFormat = GL_BGRA;
+        pixelType = GL_UNSIGNED_SHORT_4_4_4_4_REV;
+        break;
+    case TextureFormat::ARGB1555:
+        pixelFormat = GL_BGRA;
+        pixelType = GL_UNSIGNED_SHORT_1_5_5_5_REV;
+        break;
+    default:
+        pixelFormat = GL_RGBA;
+        pixelType = GL_UNSIGNED_BYTE;
+        break;
+    }
+}
+
+void glex::convertPixels(const unsigned char* pixels, int components, GLsizei width, GLsizei height,
+                         TextureFormat format, bool dither, uint16_t* output) {
+    switch (format) {
+    case TextureFormat::RGB565:
+        _convert<TextureFormat::RGB565>(pixels, components, width, height, dither, output);
+        break;
+    case TextureFormat::ARGB4444:
+        _convert<TextureFormat::ARGB4444>(pixels, components, width, height, dither, output);
+        break;
+    case TextureFormat::ARGB1555:
+        _convert<TextureFormat::ARGB1555>(pixels, components, width, height, dither, output);
+        break;
+    default:
+        break;
+    }
+}
@@ -0,0 +1,77 @@
+#include "glex/graphics/TextureManager.h"
+#include "glex/common/log.h"
+#include "glex/common/path.h"
+
+std::map<std::string, std::weak_ptr<Texture>> TextureManager::_textures;
+size_t TextureManager::_bytesResident = 0;
+
+std::shared_ptr<Texture> TextureManager::loadRGBA(std::string path, TextureFormat format, bool dither, MipmapFilter mipmapFilter) {
+    return _load(path, 4, format, dither, mipmapFilter);
+}
+
+std::shared_ptr<Texture> TextureManager::loadRGB(std::string path, TextureFormat format, bool dither, MipmapFilter mipmapFilter) {
+    return _load(path, 3, format, dither, mipmapFilter);
+}
+
+long TextureManager::referenceCount(std::string path, bool hasAlpha, TextureFormat format, bool dither, MipmapFilter mipmapFilter) {
+    auto existing = _textures.find(_key(glex::targetPlatformPath(path), hasAlpha ? 4 : 3, format, dither, mipmapFilter));
+    if (existing == _textures.end()) {
+        return 0;
+    }
+    return existing->second.use_count();
+}
+
+std::string TextureManager::_key(const std::string& platformPath, int components, TextureFormat format, bool dither, MipmapFilter mipmapFilter) {
+    // The same file loaded as RGB and RGBA are different textures
+    std::string key = platformPath + (components == 4 ? ":rgba" : ":rgb");
+    if (format != TextureFormat::Default) {
+        key += ":" + std::to_string((int)format) + (dither ? "d" : "");
+    }
+    if (mipmapFilter != MipmapFilter::None) {
+        key += ":mip" + std::to_string((int)mipmapFilter);
+    }
+    return key;
+}
+
+std::shared_ptr<Texture> TextureManager::_load(std::string path, int components, TextureFormat format, bool dither, MipmapFilter mipmapFilter) {
+    std::string platformPath = glex::targetPlatformPath(path);
+    std::string key = _key(platformPath, components, format, dither, mipmapFilter);
+    auto existing = _textures.find(key);
+    if (existing != _textures.end()) {
+        std::shared_ptr<Texture> texture = existing->second.lock();
+        if (texture) {
+            return texture;
+        }
+    }
+
+    TextureImage image;
+    if (!Texture::decodeFile(path, components, image)) {
+        return nullptr;
+    }
+    glex::generateMipmaps(image, mipmapFilter);
+    Texture::convertImage(image, format, dither);
+    Texture* texture = new Texture();
+    if (!texture->loadImage(image)) {
+        delete texture;
+        return nullptr;
+    }
+
+    // Remember the size now, users could unload the texture themselves before releasing it
+    size_t byteSize = texture->byteSize();
+    _bytesResident += byteSize;
+    DEBUG_PRINTLN("TextureManager - Loaded %s, %u bytes resident", platformPath.c_str(), (unsigned)_bytesResident);
+
+    std::shared_ptr<Texture> shared(texture, [key, byteSize](Texture* texture) { _release(key, texture, byteSize); });
+    _textures[key] = shared;
+    return shared;
+}
+
+void TextureManager::_release(std::string key, Texture* texture, size_t byteSize) {
+    _bytesResident -= byteSize;
+    delete texture;
+
+    auto existing = _textures.find(key);
+    if (existing != _textures.end() && existing->second.expired()) {
+        _textures.erase(existing);
+    }
+}
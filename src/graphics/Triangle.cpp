@@ -1,51 +1,77 @@
 #include "glex/graphics/Triangle.h"
+#include "glex/graphics/RenderQueue.h"
+#include "glex/graphics/SceneNode.h"
 #include "glex/common/log.h"
+#include "glex/math/Matrix.h"
+
+#include <algorithm>
 
 void Triangle::draw() {
-    // Set OpenGL draw settings
-    glDisable(GL_LIGHTING);
-    glEnable(GL_DEPTH_TEST);
-    glDepthFunc(GL_LESS);
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    _renderState().apply();
+    _drawTransformed();
+}
+
+void Triangle::submit(RenderQueue& queue) {
+    queue.submit(_renderState(), RenderQueue::depthForOrthoZ(z), this, [](void* triangle) {
+        static_cast<Triangle*>(triangle)->_drawTransformed();
+    });
+}
 
+RenderState Triangle::_renderState() {
+    RenderState state;
+    state.blend = true;
+    return state;
+}
+
+void Triangle::_drawTransformed() {
     glPushMatrix();
 
-    // Perform scaling and rotation
-    glScalef(scale, scale, 1.0);
-    glRotatef(rotationY, 0.0f, 1.0f, 0.0f);
-    glRotatef(rotationX, 1.0f, 0.0f, 0.0f);
+    if (node != nullptr) {
+        // The node's cached matrix, no trig per frame
+        glMultMatrixf(node->worldMatrix().data());
+    } else {
+        // Perform scaling and rotation
+        glScalef(scale, scale, 1.0);
+        if (rotationX != 0 || rotationY != 0) {
+            glMultMatrixf(Matrix4::rotationZYX(rotationX, rotationY, 0.0f).data());
+        }
+    }
 
     _drawList();
 
-    // Unset OpenGL draw settings
-    glDisable(GL_BLEND);
-
     glPopMatrix();
 }
 
-void Triangle::_drawList() {
-    // Define the vertex arrays 
-    float colors[] { 1.0, 0.0, 0.0,
-                     0.0, 1.0, 0.0,
-                     0.0, 0.0, 1.0 };
+bool Triangle::_isVerticesDirty() {
+    return !_isVerticesBuilt || _builtX != x || _builtY != y || _builtZ != z || _builtWidth != width || _builtHeight != height;
+}
 
-    float verts[] = { x,                  y - height, z,   // Bottom Left
-                      x + width,          y - height, z,   // Bottom Right
-                      x + (width / 2.0f), y,          z }; // Top Center
+void Triangle::_buildVertices() {
+    const GLfloat vertices[] = { x,                  y - height, z,   1.0, 0.0, 0.0,   // Bottom Left
+                                 x + width,          y - height, z,   0.0, 1.0, 0.0,   // Bottom Right
+                                 x + (width / 2.0f), y,          z,   0.0, 0.0, 1.0 }; // Top Center
+    std::copy(vertices, vertices + 3 * 6, _vertices);
 
-    // Enable color and vertex array drawing modes
-    glEnableClientState(GL_COLOR_ARRAY);
-    glEnableClientState(GL_VERTEX_ARRAY);
+    _builtX = x;
+    _builtY = y;
+    _builtZ = z;
+    _builtWidth = width;
+    _builtHeight = height;
+    _isVerticesBuilt = true;
+    _geometry.invalidate();
+}
 
-    // Specify the arrays to use
-    glColorPointer(3, GL_FLOAT, 0, colors);
-    glVertexPointer(3, GL_FLOAT, 0, verts);
+void Triangle::_drawList() {
+    if (_isVerticesDirty()) {
+        _buildVertices();
+    }
 
-    // Draw the tri
-    glDrawArrays(GL_TRIANGLES, 0, 3);
+    // Set every time since copies of a Triangle have their own vertices
+    _geometry.layout.stride = (GLsizei)(6 * sizeof(GLfloat));
+    _geometry.layout.colorOffset = (int)(3 * sizeof(GLfloat));
+    _geometry.vertices = _vertices;
+    _geometry.vertexCount = 3;
 
-    // Disable color and vertex array drawing modes
-    glDisableClientState(GL_VERTEX_ARRAY);
-    glDisableClientState(GL_COLOR_ARRAY);
-}
\ No newline at end of file
+    // Draw the tri
+    _geometry.draw();
+}
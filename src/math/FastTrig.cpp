@@ -0,0 +1,46 @@
+#include "glex/math/FastTrig.h"
+
+#include <cmath>
+
+#ifdef DREAMCAST
+#include <dc/fmath.h>
+
+void glex::fastSinCos(float degrees, float& sine, float& cosine) {
+    fsincos(degrees, &sine, &cosine);
+}
+
+#else
+
+static constexpr int SINE_TABLE_SIZE = 1024; // Must be a power of 2
+static constexpr int SINE_TABLE_MASK = SINE_TABLE_SIZE - 1;
+static constexpr int QUARTER_TURN = SINE_TABLE_SIZE / 4;
+
+// One full turn plus one entry, so interpolating the last entry doesn't need to wrap
+static float _sineTable[SINE_TABLE_SIZE + 1];
+
+static bool _buildSineTable() {
+    for (int i = 0; i <= SINE_TABLE_SIZE; i++) {
+        _sineTable[i] = (float)sin(i * 2.0 * 3.14159265358979323846 / SINE_TABLE_SIZE);
+    }
+    return true;
+}
+
+// Built during static initialization, so fastSinCos() has no first use check
+static const bool _isSineTableBuilt = _buildSineTable();
+
+void glex::fastSinCos(float degrees, float& sine, float& cosine) {
+    float position = degrees * (SINE_TABLE_SIZE / 360.0f);
+    float whole = floorf(position);
+    float fraction = position - whole;
+    // Masking also wraps negative angles, since the index is two's complement
+    int index = (int)whole;
+
+    int sineIndex = index & SINE_TABLE_MASK;
+    sine = _sineTable[sineIndex] + (_sineTable[sineIndex + 1] - _sineTable[sineIndex]) * fraction;
+
+    // cos(a) = sin(a + 90)
+    int cosineIndex = (index + QUARTER_TURN) & SINE_TABLE_MASK;
+    cosine = _sineTable[cosineIndex] + (_sineTable[cosineIndex + 1] - _sineTable[cosineIndex]) * fraction;
+}
+
+#endif
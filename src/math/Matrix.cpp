@@ -0,0 +1,252 @@
+#include "glex/math/Matrix.h"
+#include "glex/math/FastTrig.h"
+
+#include <cmath>
+
+#if defined(DREAMCAST)
+#include <dc/matrix.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// On the Dreamcast the products go through XMTRX, the SH4's back bank matrix register. GLdc loads
+// its own matrices into it before transforming vertices, so nothing has to be restored afterwards.
+
+Matrix4 Matrix4::frustum(float left, float right, float bottom, float top, float zNear, float zFar) {
+    Matrix4 result;
+    result.m[0] = (2.0f * zNear) / (right - left);
+    result.m[5] = (2.0f * zNear) / (top - bottom);
+    result.m[8] = (right + left) / (right - left);
+    result.m[9] = (top + bottom) / (top - bottom);
+    result.m[10] = -(zFar + zNear) / (zFar - zNear);
+    result.m[11] = -1.0f;
+    result.m[14] = -(2.0f * zFar * zNear) / (zFar - zNear);
+    result.m[15] = 0.0f;
+    return result;
+}
+
+Matrix4 Matrix4::ortho(float left, float right, float bottom, float top, float zNear, float zFar) {
+    Matrix4 result;
+    result.m[0] = 2.0f / (right - left);
+    result.m[5] = 2.0f / (top - bottom);
+    result.m[10] = -2.0f / (zFar - zNear);
+    result.m[12] = -(right + left) / (right - left);
+    result.m[13] = -(top + bottom) / (top - bottom);
+    result.m[14] = -(zFar + zNear) / (zFar - zNear);
+    return result;
+}
+
+Matrix4 Matrix4::translation(float x, float y, float z) {
+    Matrix4 result;
+    result.m[12] = x;
+    result.m[13] = y;
+    result.m[14] = z;
+    return result;
+}
+
+Matrix4 Matrix4::scaling(float x, float y, float z) {
+    Matrix4 result;
+    result.m[0] = x;
+    result.m[5] = y;
+    result.m[10] = z;
+    return result;
+}
+
+Matrix4 Matrix4::rotation(float angle, float x, float y, float z) {
+    float radians = angle * 3.14159265358979323846f / 180.0f;
+    float c = cosf(radians);
+    float s = sinf(radians);
+    float t = 1.0f - c;
+
+    Matrix4 result;
+    result.m[0] = t * x * x + c;
+    result.m[1] = t * x * y + s * z;
+    result.m[2] = t * x * z - s * y;
+    result.m[4] = t * x * y - s * z;
+    result.m[5] = t * y * y + c;
+    result.m[6] = t * y * z + s * x;
+    result.m[8] = t * x * z + s * y;
+    result.m[9] = t * y * z - s * x;
+    result.m[10] = t * z * z + c;
+    return result;
+}
+
+Matrix4 Matrix4::rotationZYX(float x, float y, float z) {
+    float sinX = 0, cosX = 1, sinY = 0, cosY = 1, sinZ = 0, cosZ = 1;
+    if (x != 0) {
+        glex::fastSinCos(x, sinX, cosX);
+    }
+    if (y != 0) {
+        glex::fastSinCos(y, sinY, cosY);
+    }
+    if (z != 0) {
+        glex::fastSinCos(z, sinZ, cosZ);
+    }
+
+    // rotationZ * rotationY * rotationX multiplied out
+    Matrix4 result;
+    result.m[0] = cosZ * cosY;
+    result.m[1] = sinZ * cosY;
+    result.m[2] = -sinY;
+    result.m[4] = cosZ * sinY * sinX - sinZ * cosX;
+    result.m[5] = sinZ * sinY * sinX + cosZ * cosX;
+    result.m[6] = cosY * sinX;
+    result.m[8] = cosZ * sinY * cosX + sinZ * sinX;
+    result.m[9] = sinZ * sinY * cosX - cosZ * sinX;
+    result.m[10] = cosY * cosX;
+    return result;
+}
+
+void Matrix4::setIdentity() {
+    for (int i = 0; i < 16; i++) {
+        m[i] = (i % 5 == 0) ? 1.0f : 0.0f;
+    }
+}
+
+void Matrix4::translate(float x, float y, float z) {
+    for (int row = 0; row < 4; row++) {
+        m[12 + row] += m[row] * x + m[4 + row] * y + m[8 + row] * z;
+    }
+}
+
+void Matrix4::scale(float x, float y, float z) {
+    for (int row = 0; row < 4; row++) {
+        m[row] *= x;
+        m[4 + row] *= y;
+        m[8 + row] *= z;
+    }
+}
+
+void Matrix4::rotate(float angle, float x, float y, float z) {
+    *this = *this * rotation(angle, x, y, z);
+}
+
+void Matrix4::rotateZYX(float x, float y, float z) {
+    if (x != 0 || y != 0 || z != 0) {
+        *this = *this * rotationZYX(x, y, z);
+    }
+}
+
+Matrix4 Matrix4::operator*(const Matrix4& other) const {
+#if defined(DREAMCAST)
+    Matrix4 result;
+    mat_load((matrix_t*)m);
+    mat_apply((matrix_t*)other.m);
+    mat_store((matrix_t*)result.m);
+    return result;
+#elif defined(__SSE2__)
+    // Each column of the result is the columns of this matrix weighted by a column of the other
+    __m128 column0 = _mm_loadu_ps(&m[0]);
+    __m128 column1 = _mm_loadu_ps(&m[4]);
+    __m128 column2 = _mm_loadu_ps(&m[8]);
+    __m128 column3 = _mm_loadu_ps(&m[12]);
+    Matrix4 result;
+    for (int column = 0; column < 4; column++) {
+        const float* b = &other.m[column * 4];
+        __m128 sum = _mm_mul_ps(column0, _mm_set1_ps(b[0]));
+        sum = _mm_add_ps(sum, _mm_mul_ps(column1, _mm_set1_ps(b[1])));
+        sum = _mm_add_ps(sum, _mm_mul_ps(column2, _mm_set1_ps(b[2])));
+        sum = _mm_add_ps(sum, _mm_mul_ps(column3, _mm_set1_ps(b[3])));
+        _mm_storeu_ps(&result.m[column * 4], sum);
+    }
+    return result;
+#else
+    return multiplyReference(*this, other);
+#endif
+}
+
+Vector4 Matrix4::operator*(const Vector4& v) const {
+#if defined(DREAMCAST)
+    float x = v.x, y = v.y, z = v.z, w = v.w;
+    mat_load((matrix_t*)m);
+    mat_trans_nodiv(x, y, z, w);
+    return Vector4(x, y, z, w);
+#elif defined(__SSE2__)
+    __m128 sum = _mm_mul_ps(_mm_loadu_ps(&m[0]), _mm_set1_ps(v.x));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(&m[4]), _mm_set1_ps(v.y)));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(&m[8]), _mm_set1_ps(v.z)));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(&m[12]), _mm_set1_ps(v.w)));
+    Vector4 result;
+    _mm_storeu_ps(&result.x, sum);
+    return result;
+#else
+    return transformReference(*this, v);
+#endif
+}
+
+Vector3 Matrix4::transformPoint(const Vector3& point) const {
+    return (*this * Vector4(point, 1.0f)).xyz();
+}
+
+void Matrix4::transformPoints(const Vector3* in, Vector3* out, size_t count) const {
+#if defined(DREAMCAST)
+    // Load once and keep XMTRX for the whole batch, ftrv per point
+    mat_load((matrix_t*)m);
+    for (size_t i = 0; i < count; i++) {
+        float x = in[i].x, y = in[i].y, z = in[i].z, w = 1.0f;
+        mat_trans_nodiv(x, y, z, w);
+        out[i] = Vector3(x, y, z);
+    }
+#elif defined(__SSE2__)
+    __m128 column0 = _mm_loadu_ps(&m[0]);
+    __m128 column1 = _mm_loadu_ps(&m[4]);
+    __m128 column2 = _mm_loadu_ps(&m[8]);
+    __m128 column3 = _mm_loadu_ps(&m[12]);
+    for (size_t i = 0; i < count; i++) {
+        __m128 sum = _mm_add_ps(column3, _mm_mul_ps(column0, _mm_set1_ps(in[i].x)));
+        sum = _mm_add_ps(sum, _mm_mul_ps(column1, _mm_set1_ps(in[i].y)));
+        sum = _mm_add_ps(sum, _mm_mul_ps(column2, _mm_set1_ps(in[i].z)));
+        // Vector3 is only 12 bytes, so store all 4 lanes to a temporary
+        float result[4];
+        _mm_storeu_ps(result, sum);
+        out[i] = Vector3(result[0], result[1], result[2]);
+    }
+#else
+    for (size_t i = 0; i < count; i++) {
+        out[i] = transformReference(*this, Vector4(in[i], 1.0f)).xyz();
+    }
+#endif
+}
+
+Matrix4 Matrix4::transposed() const {
+    Matrix4 result;
+    for (int row = 0; row < 4; row++) {
+        for (int column = 0; column < 4; column++) {
+            result.m[row * 4 + column] = m[column * 4 + row];
+        }
+    }
+    return result;
+}
+
+float Matrix4::maxAxisScale() const {
+    float maxScaleSquared = 0.0f;
+    for (int axis = 0; axis < 3; axis++) {
+        const float* column = &m[axis * 4];
+        float scaleSquared = column[0] * column[0] + column[1] * column[1] + column[2] * column[2];
+        if (scaleSquared > maxScaleSquared) {
+            maxScaleSquared = scaleSquared;
+        }
+    }
+    return sqrtf(maxScaleSquared);
+}
+
+Matrix4 Matrix4::multiplyReference(const Matrix4& a, const Matrix4& b) {
+    Matrix4 result;
+    for (int column = 0; column < 4; column++) {
+        for (int row = 0; row < 4; row++) {
+            result.m[column * 4 + row] = a.m[0 * 4 + row] * b.m[column * 4 + 0] +
+                                         a.m[1 * 4 + row] * b.m[column * 4 + 1] +
+                                         a.m[2 * 4 + row] * b.m[column * 4 + 2] +
+                                         a.m[3 * 4 + row] * b.m[column * 4 + 3];
+        }
+    }
+    return result;
+}
+
+Vector4 Matrix4::transformReference(const Matrix4& matrix, const Vector4& v) {
+    const float* m = matrix.m;
+    return Vector4(m[0] * v.x + m[4] * v.y + m[8] * v.z + m[12] * v.w,
+                   m[1] * v.x + m[5] * v.y + m[9] * v.z + m[13] * v.w,
+                   m[2] * v.x + m[6] * v.y + m[10] * v.z + m[14] * v.w,
+                   m[3] * v.x + m[7] * v.y + m[11] * v.z + m[15] * v.w);
+}
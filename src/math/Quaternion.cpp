@@ -0,0 +1,77 @@
+#include "glex/math/Quaternion.h"
+
+#include <cmath>
+
+Quaternion Quaternion::fromAxisAngle(const Vector3& axis, float angle) {
+    float halfRadians = angle * 3.14159265358979323846f / 360.0f;
+    float s = sinf(halfRadians);
+    return Quaternion(axis.x * s, axis.y * s, axis.z * s, cosf(halfRadians));
+}
+
+Quaternion Quaternion::fromEuler(float x, float y, float z) {
+    return fromAxisAngle(Vector3(0.0f, 0.0f, 1.0f), z) *
+           fromAxisAngle(Vector3(0.0f, 1.0f, 0.0f), y) *
+           fromAxisAngle(Vector3(1.0f, 0.0f, 0.0f), x);
+}
+
+Quaternion Quaternion::operator*(const Quaternion& o) const {
+    return Quaternion(w * o.x + x * o.w + y * o.z - z * o.y,
+                      w * o.y - x * o.z + y * o.w + z * o.x,
+                      w * o.z + x * o.y - y * o.x + z * o.w,
+                      w * o.w - x * o.x - y * o.y - z * o.z);
+}
+
+Quaternion Quaternion::normalized() const {
+    // Same SIMD path as any other 4 component vector
+    Vector4 v = Vector4(x, y, z, w).normalized();
+    if (v.x == 0.0f && v.y == 0.0f && v.z == 0.0f && v.w == 0.0f) {
+        return Quaternion();
+    }
+    return Quaternion(v.x, v.y, v.z, v.w);
+}
+
+Vector3 Quaternion::rotate(const Vector3& v) const {
+    // v + 2w(q x v) + 2q x (q x v), cheaper than building the matrix for a single vector
+    Vector3 q(x, y, z);
+    Vector3 t = q.cross(v) * 2.0f;
+    return v + t * w + q.cross(t);
+}
+
+Matrix4 Quaternion::toMatrix() const {
+    float xx = x * x, yy = y * y, zz = z * z;
+    float xy = x * y, xz = x * z, yz = y * z;
+    float wx = w * x, wy = w * y, wz = w * z;
+
+    Matrix4 result;
+    result.m[0] = 1.0f - 2.0f * (yy + zz);
+    result.m[1] = 2.0f * (xy + wz);
+    result.m[2] = 2.0f * (xz - wy);
+    result.m[4] = 2.0f * (xy - wz);
+    result.m[5] = 1.0f - 2.0f * (xx + zz);
+    result.m[6] = 2.0f * (yz + wx);
+    result.m[8] = 2.0f * (xz + wy);
+    result.m[9] = 2.0f * (yz - wx);
+    result.m[10] = 1.0f - 2.0f * (xx + yy);
+    return result;
+}
+
+Quaternion Quaternion::slerp(const Quaternion& a, const Quaternion& b, float t) {
+    Vector4 from(a.x, a.y, a.z, a.w);
+    Vector4 to(b.x, b.y, b.z, b.w);
+    float cosTheta = from.dot(to);
+    if (cosTheta < 0.0f) {
+        to = to * -1.0f;
+        cosTheta = -cosTheta;
+    }
+
+    Vector4 result;
+    if (cosTheta > 0.9995f) {
+        // Nearly the same rotation, a normalized lerp avoids dividing by sin(theta) ~ 0
+        result = (from + (to - from) * t).normalized();
+    } else {
+        float theta = acosf(cosTheta);
+        float sinTheta = sinf(theta);
+        result = from * (sinf((1.0f - t) * theta) / sinTheta) + to * (sinf(t * theta) / sinTheta);
+    }
+    return Quaternion(result.x, result.y, result.z, result.w);
+}
@@ -0,0 +1,94 @@
+#include "glex/math/Vector.h"
+
+#include <cmath>
+
+#if defined(DREAMCAST)
+#include <dc/fmath.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+float Vector3::dot(const Vector3& other) const {
+#ifdef DREAMCAST
+    return fipr(x, y, z, 0.0f, other.x, other.y, other.z, 0.0f);
+#else
+    return x * other.x + y * other.y + z * other.z;
+#endif
+}
+
+float Vector3::length() const {
+#ifdef DREAMCAST
+    return fsqrt(fipr_magnitude_sqr(x, y, z, 0.0f));
+#else
+    return sqrtf(x * x + y * y + z * z);
+#endif
+}
+
+Vector3 Vector3::normalized() const {
+    Vector4 v = Vector4(*this, 0.0f).normalized();
+    return Vector3(v.x, v.y, v.z);
+}
+
+#if defined(__SSE2__) && !defined(DREAMCAST)
+// Dot product of a and b in every lane
+static inline __m128 _dot4(__m128 a, __m128 b) {
+    __m128 products = _mm_mul_ps(a, b);
+    __m128 swapped = _mm_shuffle_ps(products, products, _MM_SHUFFLE(2, 3, 0, 1));
+    __m128 sums = _mm_add_ps(products, swapped);
+    swapped = _mm_shuffle_ps(sums, sums, _MM_SHUFFLE(1, 0, 3, 2));
+    return _mm_add_ps(sums, swapped);
+}
+#endif
+
+float Vector4::dot(const Vector4& other) const {
+#if defined(DREAMCAST)
+    return fipr(x, y, z, w, other.x, other.y, other.z, other.w);
+#elif defined(__SSE2__)
+    return _mm_cvtss_f32(_dot4(_mm_loadu_ps(&x), _mm_loadu_ps(&other.x)));
+#else
+    return dotReference(*this, other);
+#endif
+}
+
+float Vector4::length() const {
+#ifdef DREAMCAST
+    return fsqrt(fipr_magnitude_sqr(x, y, z, w));
+#else
+    return sqrtf(dot(*this));
+#endif
+}
+
+Vector4 Vector4::normalized() const {
+#if defined(DREAMCAST)
+    float lengthSquared = fipr_magnitude_sqr(x, y, z, w);
+    if (lengthSquared <= 0.0f) {
+        return Vector4();
+    }
+    // fsrra, accurate to about 1 part in 2^21
+    return *this * frsqrt(lengthSquared);
+#elif defined(__SSE2__)
+    __m128 v = _mm_loadu_ps(&x);
+    __m128 lengthSquared = _dot4(v, v);
+    if (_mm_cvtss_f32(lengthSquared) <= 0.0f) {
+        return Vector4();
+    }
+    // A real square root and division rather than _mm_rsqrt_ps, so it matches the reference
+    Vector4 result;
+    _mm_storeu_ps(&result.x, _mm_div_ps(v, _mm_sqrt_ps(lengthSquared)));
+    return result;
+#else
+    return normalizedReference(*this);
+#endif
+}
+
+float Vector4::dotReference(const Vector4& a, const Vector4& b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
+
+Vector4 Vector4::normalizedReference(const Vector4& v) {
+    float lengthSquared = dotReference(v, v);
+    if (lengthSquared <= 0.0f) {
+        return Vector4();
+    }
+    return v * (1.0f / sqrtf(lengthSquared));
+}
@@ -0,0 +1,144 @@
+#include "Tests.h"
+#include "glex/math/Matrix.h"
+#include "glex/math/Vector.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+// Checks the SIMD paths of glex/math against their plain C++ reference versions
+
+static const float EPSILON = 1e-5f;
+
+static float _random() {
+    return (float)rand() / RAND_MAX * 20.0f - 10.0f;
+}
+
+static Matrix4 _randomMatrix() {
+    Matrix4 matrix;
+    for (int i = 0; i < 16; i++) {
+        matrix.m[i] = _random();
+    }
+    return matrix;
+}
+
+static Vector4 _randomVector() {
+    return Vector4(_random(), _random(), _random(), _random());
+}
+
+static void _checkMatrix(const Matrix4& actual, const Matrix4& expected) {
+    for (int i = 0; i < 16; i++) {
+        CHECK_NEAR(actual.m[i], expected.m[i], EPSILON);
+    }
+}
+
+static void _checkPoint(const Vector3& actual, const Vector3& expected) {
+    CHECK_NEAR(actual.x, expected.x, EPSILON);
+    CHECK_NEAR(actual.y, expected.y, EPSILON);
+    CHECK_NEAR(actual.z, expected.z, EPSILON);
+}
+
+static void _checkVector(const Vector4& actual, const Vector4& expected) {
+    CHECK_NEAR(actual.x, expected.x, EPSILON);
+    CHECK_NEAR(actual.y, expected.y, EPSILON);
+    CHECK_NEAR(actual.z, expected.z, EPSILON);
+    CHECK_NEAR(actual.w, expected.w, EPSILON);
+}
+
+// Storage for objects that are aligned for their type but not to 16 bytes, which the SIMD loads
+// must handle
+template <typename T>
+struct _Misaligned {
+    alignas(16) unsigned char buffer[sizeof(T) + alignof(T)];
+    T* value;
+
+    _Misaligned(const T& initial) { value = new (buffer + alignof(T)) T(initial); }
+};
+
+GLEX_TEST(matrixMultiply) {
+    srand(1);
+    for (int i = 0; i < 100; i++) {
+        Matrix4 a = _randomMatrix();
+        Matrix4 b = _randomMatrix();
+        _checkMatrix(a * b, Matrix4::multiplyReference(a, b));
+    }
+}
+
+GLEX_TEST(matrixMultiplyMisaligned) {
+    srand(2);
+    for (int i = 0; i < 100; i++) {
+        _Misaligned<Matrix4> a(_randomMatrix());
+        _Misaligned<Matrix4> b(_randomMatrix());
+        CHECK(((uintptr_t)a.value & 15) != 0);
+        _checkMatrix(*a.value * *b.value, Matrix4::multiplyReference(*a.value, *b.value));
+    }
+}
+
+GLEX_TEST(matrixTransformVector) {
+    srand(3);
+    for (int i = 0; i < 100; i++) {
+        Matrix4 matrix = _randomMatrix();
+        Vector4 v = _randomVector();
+        _checkVector(matrix * v, Matrix4::transformReference(matrix, v));
+
+        _Misaligned<Matrix4> misalignedMatrix(matrix);
+        _Misaligned<Vector4> misalignedVector(v);
+        _checkVector(*misalignedMatrix.value * *misalignedVector.value, Matrix4::transformReference(matrix, v));
+    }
+}
+
+GLEX_TEST(matrixTransformPoints) {
+    srand(4);
+    Matrix4 matrix = _randomMatrix();
+    // Vector3 is 12 bytes, so most points in the array aren't 16 byte aligned
+    const size_t count = 37;
+    Vector3 points[count];
+    for (size_t i = 0; i < count; i++) {
+        points[i] = Vector3(_random(), _random(), _random());
+    }
+
+    Vector3 transformed[count];
+    matrix.transformPoints(points, transformed, count);
+    for (size_t i = 0; i < count; i++) {
+        _checkPoint(transformed[i], Matrix4::transformReference(matrix, Vector4(points[i], 1.0f)).xyz());
+    }
+
+    // In place, and for a single point
+    Vector3 inPlace[count];
+    memcpy(inPlace, points, sizeof(points));
+    matrix.transformPoints(inPlace, inPlace, count);
+    for (size_t i = 0; i < count; i++) {
+        _checkPoint(inPlace[i], transformed[i]);
+        _checkPoint(matrix.transformPoint(points[i]), transformed[i]);
+    }
+}
+
+GLEX_TEST(vectorDot) {
+    srand(5);
+    for (int i = 0; i < 100; i++) {
+        Vector4 a = _randomVector();
+        Vector4 b = _randomVector();
+        CHECK_NEAR(a.dot(b), Vector4::dotReference(a, b), EPSILON);
+
+        _Misaligned<Vector4> misalignedA(a);
+        _Misaligned<Vector4> misalignedB(b);
+        CHECK_NEAR(misalignedA.value->dot(*misalignedB.value), Vector4::dotReference(a, b), EPSILON);
+    }
+}
+
+GLEX_TEST(vectorNormalized) {
+    srand(6);
+    for (int i = 0; i < 100; i++) {
+        Vector4 v = _randomVector();
+        _checkVector(v.normalized(), Vector4::normalizedReference(v));
+        CHECK_NEAR(v.normalized().length(), 1.0f, EPSILON);
+
+        _Misaligned<Vector4> misaligned(v);
+        _checkVector(misaligned.value->normalized(), Vector4::normalizedReference(v));
+    }
+
+    // The zero vector stays zero instead of turning into NaNs
+    _checkVector(Vector4().normalized(), Vector4());
+    _checkVector(Vector4::normalizedReference(Vector4()), Vector4());
+}
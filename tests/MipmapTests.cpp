@@ -0,0 +1,136 @@
+#include "Tests.h"
+#include "glex/graphics/Mipmap.h"
+#include "glex/graphics/Texture.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// Checks the SSE2 and word at a time box filters of glex::downsampleBox() against averaging each
+// 2x2 block on its own, and the mip chains generateMipmaps() builds
+
+static unsigned char _referenceBox(const unsigned char* pixels, int components, GLsizei width, GLsizei height,
+                                   GLsizei x, GLsizei y, int channel) {
+    // Odd sizes reuse the last row or column
+    GLsizei x0 = x * 2;
+    GLsizei y0 = y * 2;
+    GLsizei x1 = x0 + 1 < width ? x0 + 1 : width - 1;
+    GLsizei y1 = y0 + 1 < height ? y0 + 1 : height - 1;
+    unsigned sum = pixels[((size_t)y0 * width + x0) * components + channel] + pixels[((size_t)y0 * width + x1) * components + channel] +
+                   pixels[((size_t)y1 * width + x0) * components + channel] + pixels[((size_t)y1 * width + x1) * components + channel];
+    return (unsigned char)((sum + 2) / 4);
+}
+
+// RGB and RGBA for one size. offset shifts both the input and the output off word alignment, so
+// the word at a time filter has to fall back to the per pixel one.
+static void _checkBox(GLsizei width, GLsizei height, size_t offset) {
+    const GLsizei outputWidth = glex::mipmapSize(width, 1);
+    const GLsizei outputHeight = glex::mipmapSize(height, 1);
+    for (int components = 3; components <= 4; components++) {
+        std::vector<unsigned char> pixels((size_t)width * height * components + offset);
+        for (unsigned char& value : pixels) {
+            value = (unsigned char)rand();
+        }
+        const size_t outputSize = (size_t)outputWidth * outputHeight * components;
+        std::vector<unsigned char> output(outputSize + offset + 1, 0xA5);
+        glex::downsampleBox(pixels.data() + offset, components, width, height, output.data() + offset);
+
+        bool isMatching = true;
+        for (GLsizei y = 0; y < outputHeight; y++) {
+            for (GLsizei x = 0; x < outputWidth; x++) {
+                for (int channel = 0; channel < components; channel++) {
+                    isMatching = isMatching && output[offset + ((size_t)y * outputWidth + x) * components + channel] ==
+                        _referenceBox(pixels.data() + offset, components, width, height, x, y, channel);
+                }
+            }
+        }
+        CHECK(isMatching);
+        // Nothing written outside of the output
+        CHECK(output[offset + outputSize] == 0xA5);
+    }
+}
+
+GLEX_TEST(downsampleBoxSmallSizes) {
+    srand(1);
+    for (GLsizei height = 1; height <= 3; height++) {
+        for (GLsizei width = 1; width < 8; width++) {
+            _checkBox(width, height, 0);
+        }
+    }
+}
+
+GLEX_TEST(downsampleBoxOddWidths) {
+    srand(2);
+    const GLsizei widths[] = { 9, 15, 17, 33, 65 };
+    for (GLsizei width : widths) {
+        _checkBox(width, 7, 0);
+        _checkBox(width, 8, 0);
+    }
+}
+
+GLEX_TEST(downsampleBoxEvenWidths) {
+    srand(3);
+    const GLsizei widths[] = { 8, 10, 16, 18, 34, 256 };
+    for (GLsizei width : widths) {
+        _checkBox(width, 6, 0);
+        _checkBox(width, 5, 0);
+    }
+}
+
+GLEX_TEST(downsampleBoxMisaligned) {
+    srand(4);
+    const GLsizei widths[] = { 4, 8, 16, 34 };
+    for (GLsizei width : widths) {
+        _checkBox(width, 4, 1);
+        _checkBox(width, 4, 2);
+    }
+}
+
+GLEX_TEST(downsampleKaiserFlat) {
+    // The weights are normalized, so a flat image stays flat whatever the overshoot elsewhere
+    for (int components = 3; components <= 4; components++) {
+        std::vector<unsigned char> pixels((size_t)12 * 6 * components, 200);
+        std::vector<unsigned char> output((size_t)6 * 3 * components);
+        glex::downsampleKaiser(pixels.data(), components, 12, 6, output.data());
+        bool isFlat = true;
+        for (unsigned char value : output) {
+            isFlat = isFlat && value == 200;
+        }
+        CHECK(isFlat);
+    }
+}
+
+GLEX_TEST(generateMipmapsChain) {
+    const GLsizei sizes[][2] = { { 16, 16 }, { 16, 4 }, { 5, 3 }, { 1, 8 } };
+    const MipmapFilter filters[] = { MipmapFilter::Box, MipmapFilter::Kaiser };
+    for (const GLsizei* size : sizes) {
+        for (MipmapFilter filter : filters) {
+            TextureImage image;
+            image.width = size[0];
+            image.height = size[1];
+            image.components = 4;
+            image.pixels.assign((size_t)size[0] * size[1] * 4, 128);
+            glex::generateMipmaps(image, filter);
+
+            // Down to 1x1, each level halving both sides
+            GLsizei largest = size[0] > size[1] ? size[0] : size[1];
+            size_t levels = 0;
+            while ((largest >> levels) > 1) {
+                levels++;
+            }
+            CHECK(image.mipmaps.size() == levels);
+            for (size_t level = 1; level <= image.mipmaps.size(); level++) {
+                size_t expected = (size_t)glex::mipmapSize(size[0], level) * glex::mipmapSize(size[1], level) * 4;
+                CHECK(image.mipmaps[level - 1].size() == expected);
+            }
+        }
+    }
+
+    TextureImage image;
+    image.width = 8;
+    image.height = 8;
+    image.components = 3;
+    image.pixels.assign(8 * 8 * 3, 0);
+    glex::generateMipmaps(image, MipmapFilter::None);
+    CHECK(image.mipmaps.empty());
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cmath>
+#include <cstdio>
+
+/*
+ * A minimal test harness for host builds (run with ctest). Tests register themselves with
+ * GLEX_TEST and report failures with the CHECK macros, which keep going after a failure so one
+ * run shows everything that's wrong.
+ */
+namespace glex {
+    namespace tests {
+        typedef void (*TestFunction)();
+
+        struct Registration {
+            Registration(const char* name, TestFunction test);
+        };
+
+        // Called by the CHECK macros
+        void fail(const char* file, int line, const char* message);
+    }
+}
+
+#define GLEX_TEST(name) \
+    static void name(); \
+    static glex::tests::Registration name##Registration(#name, name); \
+    static void name()
+
+#define CHECK(condition) \
+    do { if (!(condition)) glex::tests::fail(__FILE__, __LINE__, #condition); } while (0)
+
+// Relative to the expected value's magnitude once it's above 1
+#define CHECK_NEAR(actual, expected, epsilon) \
+    do { \
+        float _actual = (actual), _expected = (expected); \
+        float _tolerance = (epsilon) * (fabsf(_expected) > 1.0f ? fabsf(_expected) : 1.0f); \
+        if (!(fabsf(_actual - _expected) <= _tolerance)) { \
+            char _message[256]; \
+            snprintf(_message, sizeof(_message), "%s is %g, expected %g", #actual, _actual, _expected); \
+            glex::tests::fail(__FILE__, __LINE__, _message); \
+        } \
+    } while (0)
@@ -0,0 +1,151 @@
+#include "Tests.h"
+#include "glex/graphics/TextureAtlas.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+// Checks the skyline packing, edge padding and UVs of TextureAtlas through buildImages(), which
+// packs the same way build() does without uploading anything
+
+static TextureImage _randomImage(GLsizei width, GLsizei height, int components) {
+    TextureImage image;
+    image.width = width;
+    image.height = height;
+    image.components = components;
+    image.pixels.resize((size_t)width * height * components);
+    for (unsigned char& value : image.pixels) {
+        value = (unsigned char)rand();
+    }
+    return image;
+}
+
+// Where a region's image starts in its page, in pixels
+static void _regionOrigin(const AtlasRegion& region, const TextureImage& page, GLsizei& x, GLsizei& y) {
+    x = (GLsizei)lroundf(region.uv.s0 * page.width);
+    y = (GLsizei)lroundf(region.uv.t0 * page.height);
+}
+
+// Compares the page's pixel at (x, y) with the image's pixel at (column, row), clamped to its edges
+static bool _isPixelFromImage(const TextureImage& page, GLsizei x, GLsizei y, const TextureImage& image, GLsizei column, GLsizei row) {
+    column = std::min(std::max(column, 0), image.width - 1);
+    row = std::min(std::max(row, 0), image.height - 1);
+    const unsigned char* pagePixel = &page.pixels[((size_t)y * page.width + x) * 4];
+    const unsigned char* imagePixel = &image.pixels[((size_t)row * image.width + column) * image.components];
+    return pagePixel[0] == imagePixel[0] && pagePixel[1] == imagePixel[1] && pagePixel[2] == imagePixel[2] &&
+           pagePixel[3] == (image.components == 4 ? imagePixel[3] : 255);
+}
+
+static void _checkAtlas(GLsizei maxPageSize, GLsizei padding, int count) {
+    TextureAtlas atlas(maxPageSize, padding);
+    std::vector<TextureImage> images;
+    for (int i = 0; i < count; i++) {
+        GLsizei width = 1 + rand() % (maxPageSize / 4);
+        GLsizei height = 1 + rand() % (maxPageSize / 4);
+        images.push_back(_randomImage(width, height, i % 2 == 0 ? 3 : 4));
+        CHECK(atlas.add(images.back()) == i);
+    }
+
+    std::vector<TextureImage> pages;
+    CHECK(atlas.buildImages(pages));
+    CHECK(!pages.empty());
+    for (const TextureImage& page : pages) {
+        CHECK(page.width <= maxPageSize && page.height <= maxPageSize);
+        CHECK(page.components == 4 && page.format == TextureFormat::Default);
+    }
+
+    bool isInside = true;
+    bool isMatching = true;
+    bool isPaddingClamped = true;
+    for (int i = 0; i < count; i++) {
+        const AtlasRegion& region = atlas.region(i);
+        const TextureImage& image = images[i];
+        CHECK(region.texture == nullptr);
+        CHECK(region.width == image.width && region.height == image.height);
+        CHECK(region.page < pages.size());
+        if (region.page >= pages.size()) {
+            continue;
+        }
+
+        const TextureImage& page = pages[region.page];
+        GLsizei x, y;
+        _regionOrigin(region, page, x, y);
+        CHECK_NEAR(region.uv.s1, (GLfloat)(x + image.width) / page.width, 1e-6f);
+        CHECK_NEAR(region.uv.t1, (GLfloat)(y + image.height) / page.height, 1e-6f);
+        if (x - padding < 0 || y - padding < 0 || x + image.width + padding > page.width || y + image.height + padding > page.height) {
+            isInside = false;
+            continue;
+        }
+
+        for (GLsizei row = -padding; row < image.height + padding; row++) {
+            for (GLsizei column = -padding; column < image.width + padding; column++) {
+                bool isPadding = row < 0 || column < 0 || row >= image.height || column >= image.width;
+                bool isSame = _isPixelFromImage(page, x + column, y + row, image, column, row);
+                if (isPadding) {
+                    isPaddingClamped = isPaddingClamped && isSame;
+                } else {
+                    isMatching = isMatching && isSame;
+                }
+            }
+        }
+    }
+    CHECK(isInside);
+    CHECK(isMatching);
+    CHECK(isPaddingClamped);
+
+    // No two padded images share a pixel
+    bool isOverlapping = false;
+    for (int a = 0; a < count; a++) {
+        for (int b = a + 1; b < count; b++) {
+            const AtlasRegion& regionA = atlas.region(a);
+            const AtlasRegion& regionB = atlas.region(b);
+            if (regionA.page != regionB.page || regionA.page >= pages.size()) {
+                continue;
+            }
+            GLsizei ax, ay, bx, by;
+            _regionOrigin(regionA, pages[regionA.page], ax, ay);
+            _regionOrigin(regionB, pages[regionB.page], bx, by);
+            isOverlapping = isOverlapping ||
+                (ax - padding < bx + regionB.width + padding && bx - padding < ax + regionA.width + padding &&
+                 ay - padding < by + regionB.height + padding && by - padding < ay + regionA.height + padding);
+        }
+    }
+    CHECK(!isOverlapping);
+}
+
+GLEX_TEST(textureAtlasSinglePage) {
+    srand(1);
+    _checkAtlas(512, 1, 40);
+}
+
+GLEX_TEST(textureAtlasManyPages) {
+    srand(2);
+    _checkAtlas(64, 2, 200);
+}
+
+GLEX_TEST(textureAtlasNoPadding) {
+    srand(3);
+    _checkAtlas(128, 0, 100);
+}
+
+GLEX_TEST(textureAtlasImageTooLarge) {
+    // The padding counts towards the page size
+    TextureAtlas atlas(64, 1);
+    atlas.add(_randomImage(16, 16, 4));
+    atlas.add(_randomImage(63, 8, 3));
+    std::vector<TextureImage> pages;
+    CHECK(!atlas.buildImages(pages));
+
+    TextureAtlas exactAtlas(64, 0);
+    exactAtlas.add(_randomImage(64, 64, 3));
+    CHECK(exactAtlas.buildImages(pages));
+    CHECK(pages.size() == 1 && pages[0].width == 64 && pages[0].height == 64);
+}
+
+GLEX_TEST(textureAtlasRejectsConvertedImages) {
+    TextureAtlas atlas;
+    TextureImage image = _randomImage(8, 8, 4);
+    image.format = TextureFormat::RGB565;
+    CHECK(atlas.add(image) == -1);
+}
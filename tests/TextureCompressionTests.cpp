@@ -0,0 +1,225 @@
+#include "Tests.h"
+#include "glex/common/texturefile.h"
+#include "glex/graphics/TextureCompression.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// Checks twiddling, VQ and .glextex files against straightforward versions of the same layouts
+
+// Written to the working directory (the build directory under ctest) and removed afterwards
+static const char* TEXTURE_FILE_PATH = "GLEXTests.glextex";
+
+// Moves bit n of value to bit 2n, like the twiddle table in KallistiOS
+static uint32_t _spreadBits(uint32_t value) {
+    uint32_t spread = 0;
+    for (int bit = 0; bit < 16; bit++) {
+        spread |= ((value >> bit) & 1) << (2 * bit);
+    }
+    return spread;
+}
+
+static TextureImage _randomImage(GLsizei width, GLsizei height, TextureFormat format) {
+    TextureImage image;
+    image.width = width;
+    image.height = height;
+    image.components = format == TextureFormat::RGB565 ? 3 : 4;
+    image.format = format;
+    image.pixels.resize((size_t)width * height * sizeof(uint16_t));
+    for (unsigned char& byte : image.pixels) {
+        byte = (unsigned char)rand();
+    }
+    return image;
+}
+
+GLEX_TEST(twiddledIndexSquare) {
+    // One check per size, so a broken index doesn't report every texel
+    for (uint32_t size = 8; size <= 1024; size *= 2) {
+        bool isMatching = true;
+        for (uint32_t y = 0; y < size; y++) {
+            for (uint32_t x = 0; x < size; x++) {
+                isMatching = isMatching && glex::twiddledIndex(x, y, size, size) == ((_spreadBits(x) << 1) | _spreadBits(y));
+            }
+        }
+        CHECK(isMatching);
+    }
+}
+
+GLEX_TEST(twiddledIndexRectangle) {
+    const uint32_t sizes[][2] = { { 8, 64 }, { 64, 8 }, { 32, 16 }, { 8, 1024 }, { 1024, 8 } };
+    for (const uint32_t* size : sizes) {
+        const uint32_t width = size[0];
+        const uint32_t height = size[1];
+        const uint32_t square = width < height ? width : height;
+        std::vector<bool> isUsed(width * height, false);
+        bool isMatching = true;
+        bool isPermutation = true;
+        for (uint32_t y = 0; y < height; y++) {
+            for (uint32_t x = 0; x < width; x++) {
+                uint32_t index = glex::twiddledIndex(x, y, width, height);
+                // Each square follows the previous one, twiddled on its own
+                uint32_t expected = (x / square + y / square) * square * square +
+                                    glex::twiddledIndex(x % square, y % square, square, square);
+                isMatching = isMatching && index == expected;
+                if (index < width * height && !isUsed[index]) {
+                    isUsed[index] = true;
+                } else {
+                    isPermutation = false;
+                }
+            }
+        }
+        CHECK(isMatching);
+        CHECK(isPermutation);
+    }
+}
+
+GLEX_TEST(twiddleRoundTrip) {
+    srand(1);
+    const GLsizei sizes[][2] = { { 8, 8 }, { 16, 64 }, { 128, 32 } };
+    for (const GLsizei* size : sizes) {
+        const size_t count = (size_t)size[0] * size[1];
+        std::vector<uint16_t> pixels(count);
+        for (uint16_t& pixel : pixels) {
+            pixel = (uint16_t)rand();
+        }
+        std::vector<uint16_t> twiddled(count);
+        std::vector<uint16_t> untwiddled(count);
+        glex::twiddle(pixels.data(), size[0], size[1], twiddled.data());
+        glex::untwiddle(twiddled.data(), size[0], size[1], untwiddled.data());
+        CHECK(untwiddled == pixels);
+        // The first 2x2 block is (0, 0), (0, 1), (1, 0), (1, 1)
+        CHECK(twiddled[1] == pixels[size[0]] && twiddled[2] == pixels[1]);
+    }
+}
+
+GLEX_TEST(vqRoundTrip) {
+    // 256 2x2 blocks with only 64 different ones, so the codebook holds every block exactly
+    const GLsizei size = 32;
+    TextureImage image;
+    image.width = size;
+    image.height = size;
+    image.components = 4;
+    image.pixels.resize((size_t)size * size * 4);
+    for (GLsizei y = 0; y < size; y++) {
+        for (GLsizei x = 0; x < size; x++) {
+            int block = ((y / 2) * (size / 2) + x / 2) % 64;
+            unsigned char* pixel = &image.pixels[((size_t)y * size + x) * 4];
+            pixel[0] = (unsigned char)(block * 4);
+            pixel[1] = (unsigned char)(255 - block * 3);
+            pixel[2] = (unsigned char)((x & 1) * 200 + (y & 1) * 50);
+            pixel[3] = (unsigned char)(block & 1 ? 255 : 0);
+        }
+    }
+
+    const TextureFormat formats[] = { TextureFormat::RGB565, TextureFormat::ARGB4444, TextureFormat::ARGB1555 };
+    for (TextureFormat format : formats) {
+        std::vector<unsigned char> data;
+        CHECK(glex::encodeVQ(image, format, data));
+        CHECK(data.size() == glex::vqDataSize(size, size));
+        if (data.size() != glex::vqDataSize(size, size)) {
+            continue;
+        }
+
+        std::vector<uint16_t> expected((size_t)size * size);
+        std::vector<uint16_t> decoded((size_t)size * size);
+        glex::convertPixels(image.pixels.data(), 4, size, size, format, false, expected.data());
+        glex::decodeVQ(data.data(), size, size, decoded.data());
+        CHECK(decoded == expected);
+    }
+
+    // VQ textures must be square
+    image.height = size / 2;
+    image.pixels.resize((size_t)size * (size / 2) * 4);
+    std::vector<unsigned char> data;
+    CHECK(!glex::encodeVQ(image, TextureFormat::RGB565, data));
+}
+
+GLEX_TEST(textureFileRoundTrip) {
+    srand(2);
+    TextureImage twiddled = _randomImage(64, 16, TextureFormat::ARGB4444);
+    twiddled.isTwiddled = true;
+    TextureImage vq = _randomImage(32, 32, TextureFormat::RGB565);
+    vq.pixels.resize(glex::vqDataSize(32, 32));
+    vq.isTwiddled = true;
+    vq.isVQ = true;
+    TextureImage linear = _randomImage(10, 6, TextureFormat::ARGB1555);
+
+    for (const TextureImage* image : { &twiddled, &vq, &linear }) {
+        TextureImage read;
+        CHECK(glex::writeTextureFile(*image, TEXTURE_FILE_PATH));
+        CHECK(glex::readTextureFile(TEXTURE_FILE_PATH, read));
+        CHECK(read.width == image->width && read.height == image->height);
+        CHECK(read.components == image->components);
+        CHECK(read.format == image->format);
+        CHECK(read.isTwiddled == image->isTwiddled && read.isVQ == image->isVQ);
+        CHECK(read.pixels == image->pixels);
+    }
+    remove(TEXTURE_FILE_PATH);
+}
+
+GLEX_TEST(textureFileRejectsBadFiles) {
+    TextureImage image = _randomImage(8, 8, TextureFormat::RGB565);
+    image.isTwiddled = true;
+    CHECK(glex::writeTextureFile(image, TEXTURE_FILE_PATH));
+
+    FILE* file = fopen(TEXTURE_FILE_PATH, "r+b");
+    CHECK(file != NULL);
+    if (file != NULL) {
+        fwrite("XXXX", 1, 4, file);
+        fclose(file);
+    }
+    TextureImage read;
+    CHECK(!glex::readTextureFile(TEXTURE_FILE_PATH, read));
+    CHECK(!glex::readTextureFile("GLEXTests.missing.glextex", read));
+
+    // Headers promising more than the file holds, or sizes that would overflow, fail before
+    // anything is allocated
+    image.isTwiddled = false;
+    const uint32_t corruptions[][2] = {
+        { offsetof(TextureFileHeader, width), 0 },
+        { offsetof(TextureFileHeader, width), 0xFFFFFFFF },
+        { offsetof(TextureFileHeader, height), 2048 },
+        { offsetof(TextureFileHeader, dataSize), 0xFFFFFFF0 },
+        { offsetof(TextureFileHeader, dataOffset), 0xFFFFFFF0 },
+    };
+    for (const uint32_t* corruption : corruptions) {
+        CHECK(glex::writeTextureFile(image, TEXTURE_FILE_PATH));
+        file = fopen(TEXTURE_FILE_PATH, "r+b");
+        CHECK(file != NULL);
+        if (file != NULL) {
+            fseek(file, corruption[0], SEEK_SET);
+            fwrite(&corruption[1], 1, sizeof(uint32_t), file);
+            fclose(file);
+        }
+        CHECK(!glex::readTextureFile(TEXTURE_FILE_PATH, read));
+    }
+
+    // A file cut short of its pixels
+    CHECK(glex::writeTextureFile(image, TEXTURE_FILE_PATH));
+    file = fopen(TEXTURE_FILE_PATH, "rb");
+    std::vector<unsigned char> contents(sizeof(TextureFileHeader) + 8);
+    CHECK(file != NULL && fread(contents.data(), 1, contents.size(), file) == contents.size());
+    if (file != NULL) {
+        fclose(file);
+    }
+    file = fopen(TEXTURE_FILE_PATH, "wb");
+    CHECK(file != NULL);
+    if (file != NULL) {
+        fwrite(contents.data(), 1, contents.size(), file);
+        fclose(file);
+    }
+    CHECK(!glex::readTextureFile(TEXTURE_FILE_PATH, read));
+
+    // Sizes the reader would reject can't be written either
+    TextureImage tooWide = _randomImage(2048, 8, TextureFormat::RGB565);
+    CHECK(!glex::writeTextureFile(tooWide, TEXTURE_FILE_PATH));
+
+    // Pixels that don't match the size can't be written
+    image.pixels.pop_back();
+    CHECK(!glex::writeTextureFile(image, TEXTURE_FILE_PATH));
+    remove(TEXTURE_FILE_PATH);
+}
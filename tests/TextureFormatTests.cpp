@@ -0,0 +1,106 @@
+#include "Tests.h"
+#include "glex/graphics/TextureFormat.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// Checks the SSE2 and word at a time kernels of glex::convertPixels() against packing each pixel
+// on its own
+
+static const int BAYER_4X4[4][4] = {
+    {  0,  8,  2, 10 },
+    { 12,  4, 14,  6 },
+    {  3, 11,  1,  9 },
+    { 15,  7, 13,  5 }
+};
+
+// Adds the dither threshold scaled to just under one step of a channel that keeps bits bits
+static int _dithered(int value, int bits, int threshold) {
+    value += (threshold << (8 - bits)) >> 4;
+    return value > 255 ? 255 : value;
+}
+
+static uint16_t _referencePixel(const unsigned char* pixel, int components, TextureFormat format, bool dither, int x, int y) {
+    int r = pixel[0];
+    int g = pixel[1];
+    int b = pixel[2];
+    int a = components == 4 ? pixel[3] : 255;
+    int threshold = dither ? BAYER_4X4[y & 3][x & 3] : 0;
+    switch (format) {
+    case TextureFormat::RGB565:
+        return (uint16_t)((_dithered(r, 5, threshold) >> 3) << 11 | (_dithered(g, 6, threshold) >> 2) << 5 | _dithered(b, 5, threshold) >> 3);
+    case TextureFormat::ARGB4444:
+        return (uint16_t)((a >> 4) << 12 | (_dithered(r, 4, threshold) >> 4) << 8 | (_dithered(g, 4, threshold) >> 4) << 4 | _dithered(b, 4, threshold) >> 4);
+    default:
+        return (uint16_t)((a >= 128 ? 1 : 0) << 15 | (_dithered(r, 5, threshold) >> 3) << 10 | (_dithered(g, 5, threshold) >> 3) << 5 | _dithered(b, 5, threshold) >> 3);
+    }
+}
+
+// Every format, component count and dither setting for one size. With isOutputMisaligned the
+// output starts 2 bytes into a word, so the word at a time kernel can't take its fast path.
+static void _checkConvert(GLsizei width, GLsizei height, bool isOutputMisaligned) {
+    const TextureFormat formats[] = { TextureFormat::RGB565, TextureFormat::ARGB4444, TextureFormat::ARGB1555 };
+    const size_t offset = isOutputMisaligned ? 1 : 0;
+    for (int components = 3; components <= 4; components++) {
+        std::vector<unsigned char> pixels((size_t)width * height * components);
+        for (unsigned char& value : pixels) {
+            value = (unsigned char)rand();
+        }
+        // Make sure saturation near white is covered
+        pixels[0] = 255;
+        pixels[1] = 254;
+        pixels[2] = 250;
+
+        for (TextureFormat format : formats) {
+            for (int dither = 0; dither <= 1; dither++) {
+                std::vector<uint16_t> output((size_t)width * height + offset + 1, 0xDEAD);
+                glex::convertPixels(pixels.data(), components, width, height, format, dither != 0, output.data() + offset);
+
+                bool isMatching = true;
+                for (GLsizei y = 0; y < height; y++) {
+                    for (GLsizei x = 0; x < width; x++) {
+                        size_t index = (size_t)y * width + x;
+                        isMatching = isMatching &&
+                            output[offset + index] == _referencePixel(&pixels[index * components], components, format, dither != 0, x, y);
+                    }
+                }
+                CHECK(isMatching);
+                // Nothing written outside of the output
+                CHECK(output[output.size() - 1] == 0xDEAD);
+                CHECK(!isOutputMisaligned || output[0] == 0xDEAD);
+            }
+        }
+    }
+}
+
+GLEX_TEST(convertPixelsSmallWidths) {
+    srand(1);
+    for (GLsizei width = 1; width < 8; width++) {
+        _checkConvert(width, 5, false);
+    }
+}
+
+GLEX_TEST(convertPixelsOddWidths) {
+    srand(2);
+    const GLsizei widths[] = { 9, 13, 31, 33, 127 };
+    for (GLsizei width : widths) {
+        _checkConvert(width, 6, false);
+    }
+}
+
+GLEX_TEST(convertPixelsAlignedWidths) {
+    srand(3);
+    const GLsizei widths[] = { 8, 16, 64, 256 };
+    for (GLsizei width : widths) {
+        _checkConvert(width, 8, false);
+    }
+}
+
+GLEX_TEST(convertPixelsMisalignedOutput) {
+    srand(4);
+    const GLsizei widths[] = { 4, 7, 8, 16, 33 };
+    for (GLsizei width : widths) {
+        _checkConvert(width, 4, true);
+    }
+}
@@ -0,0 +1,51 @@
+#include "Tests.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+struct _Test {
+    const char* name;
+    glex::tests::TestFunction function;
+};
+
+// Function local so registrations from other files' static initializers always find it
+static std::vector<_Test>& _tests() {
+    static std::vector<_Test> tests;
+    return tests;
+}
+
+static int _failures = 0;
+
+glex::tests::Registration::Registration(const char* name, TestFunction test) {
+    _tests().push_back({ name, test });
+}
+
+void glex::tests::fail(const char* file, int line, const char* message) {
+    fprintf(stderr, "%s:%d: FAILED: %s\n", file, line, message);
+    _failures++;
+}
+
+// Runs every test, or only the ones named on the command line
+int main(int argc, char *argv[]) {
+    int failedTests = 0;
+    for (const _Test& test : _tests()) {
+        bool isSelected = argc < 2;
+        for (int i = 1; i < argc; i++) {
+            isSelected = isSelected || strcmp(argv[i], test.name) == 0;
+        }
+        if (!isSelected) {
+            continue;
+        }
+
+        int failuresBefore = _failures;
+        test.function();
+        bool passed = _failures == failuresBefore;
+        printf("%s %s\n", passed ? "[  OK  ]" : "[FAILED]", test.name);
+        if (!passed) {
+            failedTests++;
+        }
+    }
+    printf("%d of %d tests failed\n", failedTests, (int)_tests().size());
+    return failedTests == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,61 @@
+#include "glex/common/log.h"
+#include "glex/common/path.h"
+#include "glex/graphics/MeshLoader.h"
+
+#include <string>
+
+// Converts OBJ meshes to the .glexmesh binary format (see glex/common/meshfile.h) at build time,
+// so the console loads them without parsing any text.
+//
+// Usage: GLEXMeshConverter input.obj [output.glexmesh]
+// The output defaults to the input path with a .glexmesh extension.
+
+int main(int argc, char *argv[]) {
+    if (argc < 2 || argc > 3) {
+        ERROR_PRINTLN("Usage: %s input.obj [output.glexmesh]", argv[0]);
+        return 1;
+    }
+
+    std::string inputPath = argv[1];
+    std::string outputPath;
+    if (argc == 3) {
+        outputPath = argv[2];
+    } else {
+        size_t extension = inputPath.find_last_of('.');
+        size_t directory = inputPath.find_last_of('/');
+        if (extension == std::string::npos || (directory != std::string::npos && extension < directory)) {
+            extension = inputPath.size();
+        }
+        outputPath = inputPath.substr(0, extension) + ".glexmesh";
+    }
+
+    MeshData* meshData = MeshLoader::loadObjMesh(inputPath);
+    if (meshData == NULL) {
+        return 1;
+    }
+    bool success = MeshLoader::saveBinaryMesh(meshData, outputPath);
+    delete meshData;
+    if (!success) {
+        return 1;
+    }
+
+    // Read it back, so a broken file fails the build instead of the game
+    meshData = MeshLoader::loadBinaryMesh(outputPath);
+    if (meshData == NULL) {
+        return 1;
+    }
+    // The textures are looked up next to the output, so they must have been copied along with it
+    for (const MeshMaterial& material : meshData->materials) {
+        if (!material.diffuseTexturePath.empty() && !glex::pathExists(material.diffuseTexturePath)) {
+            ERROR_PRINTLN("Texture %s of material %s not found next to %s", material.diffuseTextureName.c_str(), material.name.c_str(), outputPath.c_str());
+            success = false;
+        }
+    }
+    delete meshData;
+    if (!success) {
+        return 1;
+    }
+
+    DEBUG_PRINTLN("Wrote %s", outputPath.c_str());
+    return 0;
+}
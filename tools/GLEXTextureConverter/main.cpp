@@ -0,0 +1,74 @@
+#include "glex/common/log.h"
+#include "glex/graphics/Texture.h"
+#include "glex/graphics/TextureCompression.h"
+
+#include <cstring>
+#include <string>
+
+// Converts images to the .glextex format (see glex/common/texturefile.h) at build time: 16 bit,
+// twiddled and optionally VQ compressed, so the Dreamcast uploads them without touching a pixel.
+//
+// Usage: GLEXTextureConverter [--rgb565|--argb4444|--argb1555] [--vq] [--no-dither] input [output.glextex]
+// The format defaults to RGB565, and the output to the input path with a .glextex extension.
+// VQ textures are never dithered, so --no-dither can't be combined with --vq.
+
+int main(int argc, char *argv[]) {
+    TextureFormat format = TextureFormat::RGB565;
+    bool vq = false;
+    bool dither = true;
+    std::string inputPath;
+    std::string outputPath;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--rgb565") == 0) {
+            format = TextureFormat::RGB565;
+        } else if (strcmp(argv[i], "--argb4444") == 0) {
+            format = TextureFormat::ARGB4444;
+        } else if (strcmp(argv[i], "--argb1555") == 0) {
+            format = TextureFormat::ARGB1555;
+        } else if (strcmp(argv[i], "--vq") == 0) {
+            vq = true;
+        } else if (strcmp(argv[i], "--no-dither") == 0) {
+            dither = false;
+        } else if (inputPath.empty()) {
+            inputPath = argv[i];
+        } else if (outputPath.empty()) {
+            outputPath = argv[i];
+        } else {
+            inputPath.clear();
+            break;
+        }
+    }
+    if (inputPath.empty()) {
+        ERROR_PRINTLN("Usage: %s [--rgb565|--argb4444|--argb1555] [--vq] [--no-dither] input [output.glextex]", argv[0]);
+        return 1;
+    }
+    if (vq && !dither) {
+        ERROR_PRINTLN("--no-dither has no effect with --vq, VQ textures are never dithered");
+        return 1;
+    }
+    if (outputPath.empty()) {
+        size_t extension = inputPath.find_last_of('.');
+        size_t directory = inputPath.find_last_of('/');
+        if (extension == std::string::npos || (directory != std::string::npos && extension < directory)) {
+            extension = inputPath.size();
+        }
+        outputPath = inputPath.substr(0, extension) + ".glextex";
+    }
+
+    TextureImage image;
+    if (!Texture::decodeFile(inputPath, format == TextureFormat::RGB565 ? 3 : 4, image) ||
+        !glex::compressImage(image, format, vq, dither) ||
+        !glex::writeTextureFile(image, outputPath)) {
+        return 1;
+    }
+
+    // Read it back, so a broken file fails the build instead of the game
+    TextureImage written;
+    if (!glex::readTextureFile(outputPath, written) || written.pixels != image.pixels) {
+        ERROR_PRINTLN("Failed to read back %s", outputPath.c_str());
+        return 1;
+    }
+
+    DEBUG_PRINTLN("Wrote %s (%dx%d, %u bytes)", outputPath.c_str(), (int)image.width, (int)image.height, (unsigned)image.pixels.size());
+    return 0;
+}